@@ -1,29 +1,159 @@
+import codecs
+import logging
+import re
+
 import esphome.codegen as cg
 import esphome.config_validation as cv
-from esphome import automation, pins
-from esphome.components import display
+import esphome.final_validate as fv
+from esphome import automation, core, pins
+from esphome.components import display, sensor, text_sensor, time as time_, uart
 from esphome.const import (
   CONF_ID, 
+  CONF_FILE,
   CONF_LAMBDA,
+  CONF_PAGES,
+  CONF_PAGE_ID,
   CONF_CLOCK_PIN,
   CONF_DATA_PIN,
+  CONF_FREQUENCY,
+  CONF_INVERTED,
+  CONF_NUMBER,
+  CONF_PLATFORM,
   CONF_RESET_PIN,
-  CONF_BRIGHTNESS
+  CONF_BRIGHTNESS,
+  CONF_SENSOR,
+  CONF_TIME_ID,
+  CONF_UPDATE_INTERVAL,
+  CONF_UART_ID,
+  CONF_PORT,
+  CONF_TIMEOUT,
+  CONF_TYPE,
+  CONF_MIN_VALUE,
+  CONF_MAX_VALUE,
+  DEVICE_CLASS_CURRENT,
+  PLATFORM_ESP32,
+  PLATFORM_ESP8266,
+  PLATFORM_HOST,
+  STATE_CLASS_MEASUREMENT,
+  UNIT_AMPERE,
 )
-from esphome.core import ID
+from esphome.core import CORE, ID
 from esphome.cpp_generator import MockObj, TemplateArgsType
 from esphome.types import ConfigType
 
+_LOGGER = logging.getLogger(__name__)
+
 CODEOWNERS = ["@shadow578"]
 DEPENDENCIES = []
 
 CONF_LOAD_PIN = "load_pin"
 CONF_LOW_PEAK_CURRENT = "reduce_peak_current"
 CONF_ROTATE_SCREEN = "rotate_screen"
+CONF_FAST_GPIO = "fast_gpio"
 CONF_CUSTOM_GLYPHS = "custom_glyphs"
 
 CONF_GLYPH_CHAR = "char"
 CONF_GLYPH_GLYPH = "glyph"
+CONF_GLYPHS = "glyphs"
+CONF_FONT_BANKS = "font_banks"
+CONF_FONT_BANK = "font_bank"
+CONF_KEY = "key"
+CONF_ROWS = "rows"
+
+CONF_ANIMATIONS = "animations"
+CONF_ANIMATION = "animation"
+CONF_FRAMES = "frames"
+CONF_FRAME_DURATION = "frame_duration"
+CONF_DELTA_ENCODE = "delta_encode"
+CONF_LOOP = "loop"
+
+CONF_MESSAGE_SCROLL_INTERVAL = "message_scroll_interval"
+CONF_TEXT = "text"
+CONF_PRIORITY = "priority"
+CONF_DURATION = "duration"
+CONF_SCROLL = "scroll"
+CONF_EXPIRY = "expiry"
+
+CONF_AUTO_BRIGHTNESS = "auto_brightness"
+CONF_MIN_ILLUMINANCE = "min_illuminance"
+CONF_MAX_ILLUMINANCE = "max_illuminance"
+CONF_MIN_BRIGHTNESS = "min_brightness"
+CONF_MAX_BRIGHTNESS = "max_brightness"
+CONF_HYSTERESIS = "hysteresis"
+CONF_STEP_INTERVAL = "step_interval"
+CONF_NIGHT_MODE = "night_mode"
+CONF_START = "start"
+CONF_END = "end"
+CONF_ENABLED = "enabled"
+
+CONF_ADAPTIVE_UPDATE = "adaptive_update"
+CONF_MAX_INTERVAL = "max_interval"
+CONF_STATIC_UPDATES = "static_updates"
+CONF_IDLE = "idle"
+CONF_STREAM = "stream"
+CONF_FRAME_MIRROR = "frame_mirror"
+CONF_INTERVAL = "interval"
+CONF_DELTA = "delta"
+
+CONF_FEATURES = "features"
+CONF_PRINTF = "printf"
+CONF_STRFTIME = "strftime"
+CONF_ROTATION = "rotation"
+CONF_PROPORTIONAL = "proportional"
+CONF_FONT = "font"
+CONF_GLYPH_CACHE_SIZE = "glyph_cache_size"
+CONF_MESSAGE_QUEUE_SIZE = "message_queue_size"
+
+CONF_POWER = "power"
+CONF_LED_CURRENT = "led_current"
+CONF_BASE_CURRENT = "base_current"
+CONF_MAX_CURRENT = "max_current"
+
+CONF_BUS_TRACE = "bus_trace"
+CONF_SIZE = "size"
+
+CONF_VIRTUAL_SCREEN = "virtual_screen"
+
+CONF_INTERRUPT_TRANSMIT = "interrupt_transmit"
+CONF_QUEUE_SIZE = "queue_size"
+
+CONF_SYNC = "sync"
+CONF_LEAD = "lead"
+
+CONF_GRAPHS = "graphs"
+
+CONF_SEQUENCES = "sequences"
+CONF_SEQUENCE = "sequence"
+CONF_STEPS = "steps"
+CONF_SHOW = "show"
+CONF_BLINK = "blink"
+CONF_FADE = "fade"
+CONF_WAIT = "wait"
+CONF_COUNT = "count"
+CONF_PERIOD = "period"
+
+CONF_LAYOUT = "layout"
+CONF_LAYOUT_ID = "layout_id"
+CONF_POSITION = "position"
+CONF_WIDTH = "width"
+CONF_ALIGN = "align"
+CONF_FORMAT = "format"
+CONF_ICON = "icon"
+
+CONF_DIGIT = "digit"
+CONF_BLINK_PERIOD = "blink_period"
+CONF_INVERT = "invert"
+CONF_UNDERLINE = "underline"
+CONF_RAW_DATA_ID = "raw_data_id"
+
+# screen geometry
+SCREEN_DIGITS = 8
+GLYPH_ROWS = 7
+GLYPH_COLS = 5
+SCREEN_COLS = SCREEN_DIGITS * GLYPH_COLS
+
+# size of a SDAGlyphCache slot (key, last use, glyph and flag, padded)
+GLYPH_CACHE_SLOT_SIZE = 16
 
 sda5708_ns = cg.esphome_ns.namespace("sda5708")
 SDADisplayComponent = sda5708_ns.class_(
@@ -32,7 +162,44 @@ SDADisplayComponent = sda5708_ns.class_(
   cg.PollingComponent
 )
 
+SDAAnimation = sda5708_ns.class_("SDAAnimation")
+SDAPage = sda5708_ns.class_("SDA5708Page")
+SDAFontBank = sda5708_ns.class_("SDAFontBank")
+SDAGraph = sda5708_ns.class_("SDAGraph")
+SDAGraphType = sda5708_ns.enum("SDAGraphType", is_class=True)
+GRAPH_TYPES = {
+    "bar": SDAGraphType.BAR,
+    "columns": SDAGraphType.COLUMNS,
+    "sparkline": SDAGraphType.SPARKLINE,
+}
+SDASequence = sda5708_ns.class_("SDASequence")
+SDASequenceStepType = sda5708_ns.enum("SDASequenceStepType", is_class=True)
+SDALayout = sda5708_ns.class_("SDALayout")
+SDAGlyph = sda5708_ns.class_("SDAGlyph_t")
+SDALayoutAlign = sda5708_ns.enum("SDALayoutAlign", is_class=True)
+LAYOUT_ALIGNS = {
+    "left": SDALayoutAlign.LEFT,
+    "right": SDALayoutAlign.RIGHT,
+}
+
 SetBrightnessAction = sda5708_ns.class_("SetBrightnessAction", automation.Action)
+FadeBrightnessAction = sda5708_ns.class_("FadeBrightnessAction", automation.Action)
+SetAutoBrightnessAction = sda5708_ns.class_("SetAutoBrightnessAction", automation.Action)
+WakeAction = sda5708_ns.class_("WakeAction", automation.Action)
+PlayAnimationAction = sda5708_ns.class_("PlayAnimationAction", automation.Action)
+StopAnimationAction = sda5708_ns.class_("StopAnimationAction", automation.Action)
+ShowMessageAction = sda5708_ns.class_("ShowMessageAction", automation.Action)
+ClearMessagesAction = sda5708_ns.class_("ClearMessagesAction", automation.Action)
+ShowPageAction = sda5708_ns.class_("ShowPageAction", automation.Action)
+RunSequenceAction = sda5708_ns.class_("RunSequenceAction", automation.Action)
+StopSequenceAction = sda5708_ns.class_("StopSequenceAction", automation.Action)
+SetDigitAttributesAction = sda5708_ns.class_("SetDigitAttributesAction", automation.Action)
+NextPageAction = sda5708_ns.class_("NextPageAction", automation.Action)
+PreviousPageAction = sda5708_ns.class_("PreviousPageAction", automation.Action)
+SetFontBankAction = sda5708_ns.class_("SetFontBankAction", automation.Action)
+SetGlyphAction = sda5708_ns.class_("SetGlyphAction", automation.Action)
+BenchmarkAction = sda5708_ns.class_("BenchmarkAction", automation.Action)
+DumpBusTraceAction = sda5708_ns.class_("DumpBusTraceAction", automation.Action)
 
 
 def validate_custom_glyph(value):
@@ -66,7 +233,498 @@ CUSTOM_GLYPH_SCHEMA = cv.Schema(
     }
 )
 
-CONFIG_SCHEMA = (
+def glyph_char_code(char):
+    # glyph chars are a single character or a C-style escape (e.g. "\1")
+    try:
+        decoded = codecs.decode(char, "unicode_escape")
+    except UnicodeDecodeError as err:
+        raise cv.Invalid(f"Invalid glyph char '{char}'.") from err
+    if len(decoded) != 1 or ord(decoded) > 0xFF:
+        raise cv.Invalid(f"Glyph char '{char}' must be a single 8-bit character.")
+    return ord(decoded)
+
+
+def validate_font_bank_glyphs(value):
+    # font bank glyphs are indexed by their character code
+    seen = set()
+    for glyph_config in value:
+        code = glyph_char_code(glyph_config[CONF_GLYPH_CHAR])
+        if code in seen:
+            raise cv.Invalid(f"Font bank glyph char '{glyph_config[CONF_GLYPH_CHAR]}' is defined more than once.")
+        seen.add(code)
+    return value
+
+
+FONT_BANK_SCHEMA = cv.Schema(
+    {
+        cv.Required(CONF_ID): cv.declare_id(SDAFontBank),
+        cv.GenerateID(CONF_RAW_DATA_ID): cv.declare_id(cg.uint8),
+        cv.Required(CONF_GLYPHS): cv.All(
+            cv.ensure_list(CUSTOM_GLYPH_SCHEMA),
+            cv.Length(min=1, max=255),
+            validate_font_bank_glyphs,
+        ),
+    }
+)
+
+
+def validate_graph(config):
+    if config[CONF_MIN_VALUE] >= config[CONF_MAX_VALUE]:
+        raise cv.Invalid(f"{CONF_MIN_VALUE} must be lower than {CONF_MAX_VALUE}.")
+    return config
+
+
+GRAPH_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.Required(CONF_ID): cv.declare_id(SDAGraph),
+            cv.Optional(CONF_TYPE, default="sparkline"): cv.enum(GRAPH_TYPES, lower=True),
+            cv.Optional(CONF_SENSOR): cv.use_id(sensor.Sensor),
+            cv.Optional(CONF_MIN_VALUE, default=0.0): cv.float_,
+            cv.Required(CONF_MAX_VALUE): cv.float_,
+        }
+    ),
+    validate_graph,
+)
+
+
+def validate_layout_icon(value):
+    value = cv.string_strict(value)
+    glyph_char_code(value)
+    return value
+
+
+PRINTF_CONVERSION = re.compile(r"%(%|[-+ #0]*\d*(?:\.\d*)?([a-zA-Z]))")
+STRFTIME_CONVERSION = re.compile(r"%([EO]?.?)")
+STRFTIME_DIRECTIVES = set("aAbBcCdDeFgGhHIjmMnprRStTuUVwWxXyYzZ%")
+
+
+def validate_sensor_format(value):
+    # the format gets the sensor state as its only argument, a float
+    conversions = [match.group(2) for match in PRINTF_CONVERSION.finditer(value) if match.group(1) != "%"]
+    if len(conversions) != 1 or conversions[0] not in "fFeEgGaA":
+        raise cv.Invalid(f"Sensor format '{value}' must contain exactly one float conversion (e.g. %.1f).")
+    if value.count("%") != sum(2 if match.group(1) == "%" else 1 for match in PRINTF_CONVERSION.finditer(value)):
+        raise cv.Invalid(f"Sensor format '{value}' contains an incomplete conversion.")
+    return value
+
+
+def validate_time_format(value):
+    for match in STRFTIME_CONVERSION.finditer(value):
+        directive = match.group(1)[-1:]
+        if directive == "" or directive not in STRFTIME_DIRECTIVES:
+            raise cv.Invalid(f"Time format '{value}' contains the unknown directive '%{match.group(1)}'.")
+    return value
+
+
+def validate_layout_field(config):
+    config = config.copy()
+    if CONF_TEXT in config:
+        default_width = len(config[CONF_TEXT])
+    elif CONF_ICON in config:
+        default_width = 1
+    else:
+        default_width = SCREEN_DIGITS - config[CONF_POSITION]
+    config.setdefault(CONF_WIDTH, max(default_width, 1))
+
+    if config[CONF_POSITION] + config[CONF_WIDTH] > SCREEN_DIGITS:
+        raise cv.Invalid(f"Field at position {config[CONF_POSITION]} with width {config[CONF_WIDTH]} does not fit the screen.")
+
+    if CONF_FORMAT in config and CONF_SENSOR not in config and CONF_TIME_ID not in config:
+        raise cv.Invalid(f"{CONF_FORMAT} is only used by sensor and time fields.")
+    if CONF_SENSOR in config:
+        config.setdefault(CONF_FORMAT, "%.1f")
+        config.setdefault(CONF_ALIGN, "right")
+        validate_sensor_format(config[CONF_FORMAT])
+    if CONF_TIME_ID in config:
+        config.setdefault(CONF_FORMAT, "%H:%M")
+        validate_time_format(config[CONF_FORMAT])
+    config.setdefault(CONF_ALIGN, "left")
+    return config
+
+
+def validate_layout(value):
+    # fields may not share digits, each digit is written by a single source
+    used = 0
+    for field in value:
+        digits = ((1 << field[CONF_WIDTH]) - 1) << field[CONF_POSITION]
+        if used & digits:
+            raise cv.Invalid(f"Layout field at position {field[CONF_POSITION]} overlaps another field.")
+        used |= digits
+    return value
+
+
+LAYOUT_FIELD_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.Required(CONF_POSITION): cv.int_range(min=0, max=SCREEN_DIGITS - 1),
+            cv.Optional(CONF_WIDTH): cv.int_range(min=1, max=SCREEN_DIGITS),
+            cv.Optional(CONF_ALIGN): cv.one_of(*LAYOUT_ALIGNS, lower=True),
+            cv.Optional(CONF_TEXT): cv.string_strict,
+            cv.Optional(CONF_ICON): validate_layout_icon,
+            cv.Optional(CONF_SENSOR): cv.use_id(sensor.Sensor),
+            cv.Optional(CONF_TIME_ID): cv.use_id(time_.RealTimeClock),
+            cv.Optional(CONF_FORMAT): cv.string_strict,
+        }
+    ),
+    cv.has_exactly_one_key(CONF_TEXT, CONF_ICON, CONF_SENSOR, CONF_TIME_ID),
+    validate_layout_field,
+)
+
+
+def validate_animation_frame(value):
+    # animation frames are drawn like custom glyphs, but span the whole screen.
+    # each frame is a list of 7 strings, each up to 40 characters wide (8 digits x 5 columns).
+    # shorter rows are padded with unlit pixels on the right.
+    if not isinstance(value, list):
+        raise cv.Invalid("Frame must be a list of strings.")
+    if len(value) != GLYPH_ROWS:
+        raise cv.Invalid(f"Frame must have exactly {GLYPH_ROWS} rows.")
+
+    for row in value:
+        if not isinstance(row, str):
+            raise cv.Invalid("Each row of the frame must be a string.")
+        if len(row) > SCREEN_COLS:
+            raise cv.Invalid(f"Each row of the frame must be at most {SCREEN_COLS} characters long.")
+        for char in row:
+            if char not in [' ', '#']:
+                raise cv.Invalid("Each character in the frame must be either ' ' or '#'.")
+
+    return [row.ljust(SCREEN_COLS) for row in value]
+
+
+ANIMATION_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.Required(CONF_ID): cv.declare_id(SDAAnimation),
+            cv.GenerateID(CONF_RAW_DATA_ID): cv.declare_id(cg.uint8),
+            cv.Optional(CONF_FRAMES): cv.All(
+                cv.ensure_list(
+                    cv.All(cv.ensure_list(cv.string), validate_animation_frame)
+                ),
+                cv.Length(min=1),
+            ),
+            cv.Optional(CONF_FILE): cv.file_,
+            cv.Optional(CONF_FRAME_DURATION, default="100ms"): cv.positive_time_period_milliseconds,
+            cv.Optional(CONF_DELTA_ENCODE, default=False): cv.boolean,
+        }
+    ),
+    cv.has_exactly_one_key(CONF_FRAMES, CONF_FILE),
+)
+
+SEQUENCE_STEP_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.Optional(CONF_SHOW): cv.maybe_simple_value(
+                {
+                    cv.Required(CONF_TEXT): cv.string_strict,
+                    cv.Optional(CONF_DURATION, default="2s"): cv.positive_time_period_milliseconds,
+                },
+                key=CONF_TEXT,
+            ),
+            cv.Optional(CONF_SCROLL): cv.maybe_simple_value(
+                {
+                    cv.Required(CONF_TEXT): cv.string_strict,
+                    cv.Optional(CONF_INTERVAL, default="50ms"): cv.positive_time_period_milliseconds,
+                },
+                key=CONF_TEXT,
+            ),
+            cv.Optional(CONF_BLINK): cv.maybe_simple_value(
+                {
+                    cv.Required(CONF_TEXT): cv.string_strict,
+                    cv.Optional(CONF_COUNT, default=3): cv.int_range(min=1, max=255),
+                    cv.Optional(CONF_PERIOD, default="500ms"): cv.positive_time_period_milliseconds,
+                },
+                key=CONF_TEXT,
+            ),
+            cv.Optional(CONF_FADE): cv.maybe_simple_value(
+                {
+                    cv.Required(CONF_BRIGHTNESS): cv.int_range(min=0, max=7),
+                    cv.Optional(CONF_DURATION, default="1s"): cv.positive_time_period_milliseconds,
+                },
+                key=CONF_BRIGHTNESS,
+            ),
+            cv.Optional(CONF_WAIT): cv.positive_time_period_milliseconds,
+        }
+    ),
+    cv.has_exactly_one_key(CONF_SHOW, CONF_SCROLL, CONF_BLINK, CONF_FADE, CONF_WAIT),
+)
+
+SEQUENCE_SCHEMA = cv.Schema(
+    {
+        cv.Required(CONF_ID): cv.declare_id(SDASequence),
+        cv.Required(CONF_STEPS): cv.All(cv.ensure_list(SEQUENCE_STEP_SCHEMA), cv.Length(min=1)),
+    }
+)
+
+
+def validate_time_of_day(value):
+    # "HH:MM" -> minutes since midnight
+    value = cv.string(value)
+    try:
+        hour, minute = (int(part) for part in value.split(":"))
+    except ValueError as err:
+        raise cv.Invalid(f"Invalid time of day '{value}', expected HH:MM.") from err
+    if not (0 <= hour < 24 and 0 <= minute < 60):
+        raise cv.Invalid(f"Invalid time of day '{value}', expected HH:MM.")
+    return hour * 60 + minute
+
+
+def validate_auto_brightness(config):
+    if config[CONF_MIN_ILLUMINANCE] >= config[CONF_MAX_ILLUMINANCE]:
+        raise cv.Invalid(f"{CONF_MIN_ILLUMINANCE} must be lower than {CONF_MAX_ILLUMINANCE}.")
+    if config[CONF_MIN_BRIGHTNESS] > config[CONF_MAX_BRIGHTNESS]:
+        raise cv.Invalid(f"{CONF_MIN_BRIGHTNESS} must not be higher than {CONF_MAX_BRIGHTNESS}.")
+    return config
+
+
+AUTO_BRIGHTNESS_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.Required(CONF_SENSOR): cv.use_id(sensor.Sensor),
+            cv.Optional(CONF_MIN_ILLUMINANCE, default=1.0): cv.positive_float,
+            cv.Optional(CONF_MAX_ILLUMINANCE, default=1000.0): cv.positive_float,
+            cv.Optional(CONF_MIN_BRIGHTNESS, default=0): cv.int_range(min=0, max=7),
+            cv.Optional(CONF_MAX_BRIGHTNESS, default=7): cv.int_range(min=0, max=7),
+            cv.Optional(CONF_HYSTERESIS, default=0.25): cv.float_range(min=0.0, max=2.0),
+            cv.Optional(CONF_STEP_INTERVAL, default="250ms"): cv.positive_time_period_milliseconds,
+        }
+    ),
+    validate_auto_brightness,
+)
+
+NIGHT_MODE_SCHEMA = cv.Schema(
+    {
+        cv.Required(CONF_TIME_ID): cv.use_id(time_.RealTimeClock),
+        cv.Optional(CONF_START, default="22:00"): validate_time_of_day,
+        cv.Optional(CONF_END, default="07:00"): validate_time_of_day,
+        cv.Optional(CONF_BRIGHTNESS, default=1): cv.int_range(min=0, max=7),
+    }
+)
+
+ADAPTIVE_UPDATE_SCHEMA = cv.Schema(
+    {
+        cv.Required(CONF_MAX_INTERVAL): cv.positive_time_period_milliseconds,
+        cv.Optional(CONF_STATIC_UPDATES, default=10): cv.int_range(min=1, max=65535),
+    }
+)
+
+IDLE_SCHEMA = cv.Schema(
+    {
+        cv.Required(CONF_TIMEOUT): cv.positive_not_null_time_period,
+        cv.Optional(CONF_BRIGHTNESS): cv.int_range(min=0, max=7),
+    }
+)
+
+def validate_adaptive_update(config):
+    if CONF_ADAPTIVE_UPDATE in config:
+        max_interval = config[CONF_ADAPTIVE_UPDATE][CONF_MAX_INTERVAL]
+        if max_interval <= config[CONF_UPDATE_INTERVAL]:
+            raise cv.Invalid(f"{CONF_ADAPTIVE_UPDATE}: {CONF_MAX_INTERVAL} must be longer than {CONF_UPDATE_INTERVAL}.")
+        if CONF_SYNC in config:
+            raise cv.Invalid(f"{CONF_ADAPTIVE_UPDATE} cannot be used together with {CONF_SYNC}.")
+    return config
+
+
+def validate_sync(config):
+    if config[CONF_LEAD] >= config[CONF_INTERVAL]:
+        raise cv.Invalid(f"{CONF_LEAD} must be shorter than {CONF_INTERVAL}.")
+    return config
+
+
+SYNC_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.Required(CONF_TIME_ID): cv.use_id(time_.RealTimeClock),
+            cv.Optional(CONF_INTERVAL, default="1s"): cv.All(
+                cv.positive_time_period_milliseconds,
+                cv.Range(min=cv.TimePeriod(milliseconds=10)),
+            ),
+            cv.Optional(CONF_LEAD, default="50ms"): cv.positive_time_period_milliseconds,
+        }
+    ),
+    validate_sync,
+)
+
+
+FEATURES_SCHEMA = cv.Schema(
+    {
+        cv.Optional(CONF_PRINTF, default=True): cv.boolean,
+        cv.Optional(CONF_STRFTIME, default=True): cv.boolean,
+        cv.Optional(CONF_CUSTOM_GLYPHS, default=True): cv.boolean,
+        cv.Optional(CONF_ROTATION, default=True): cv.boolean,
+        cv.Optional(CONF_PROPORTIONAL, default=True): cv.boolean,
+        cv.Optional(CONF_FONT, default="full"): cv.one_of("full", "digits", lower=True),
+        cv.Optional(CONF_GLYPH_CACHE_SIZE, default=32): cv.int_range(min=0, max=128),
+        cv.Optional(CONF_MESSAGE_QUEUE_SIZE, default=8): cv.int_range(min=1, max=64),
+    }
+)
+
+def validate_features(config):
+    features = config[CONF_FEATURES]
+    if config.get(CONF_ROTATE_SCREEN, False) and not features[CONF_ROTATION]:
+        raise cv.Invalid(f"{CONF_ROTATE_SCREEN} requires the {CONF_ROTATION} feature.")
+    if CONF_CUSTOM_GLYPHS in config and not features[CONF_CUSTOM_GLYPHS]:
+        raise cv.Invalid(f"{CONF_CUSTOM_GLYPHS} requires the {CONF_CUSTOM_GLYPHS} feature.")
+    for field in config.get(CONF_LAYOUT, []):
+        if CONF_SENSOR in field and not features[CONF_PRINTF]:
+            raise cv.Invalid(f"{CONF_LAYOUT}: sensor fields require the {CONF_PRINTF} feature.")
+        if CONF_TIME_ID in field and not features[CONF_STRFTIME]:
+            raise cv.Invalid(f"{CONF_LAYOUT}: time fields require the {CONF_STRFTIME} feature.")
+    return config
+
+
+def is_register_pin(config):
+    """Can the pin be written through the GPIO registers? Pins of I/O expanders have their expander's key."""
+    if any(key in config for key in pins.PIN_SCHEMA_REGISTRY if key != CORE.target_platform):
+        return False
+    # GPIO16 of the ESP8266 is not part of the regular GPIO registers
+    return CORE.is_esp32 or (CORE.is_esp8266 and config[CONF_NUMBER] < 16)
+
+
+def count_displays():
+    """Number of configured sda5708 displays. Settings fixed by build flags hold for all of them."""
+    return sum(1 for conf in CORE.config.get("display", []) if conf.get(CONF_PLATFORM) == "sda5708")
+
+
+def validate_power_of_two(value):
+    value = cv.positive_not_null_int(value)
+    if value & (value - 1) != 0:
+        raise cv.Invalid(f"{value} is not a power of two.")
+    return value
+
+
+BUS_TRACE_SCHEMA = cv.Schema(
+    {
+        cv.Optional(CONF_SIZE, default=256): cv.All(validate_power_of_two, cv.int_range(min=16, max=4096)),
+    }
+)
+
+VIRTUAL_SCREEN_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.Optional(CONF_FILE): cv.string_strict,
+            cv.Optional(CONF_INTERVAL, default="100ms"): cv.positive_time_period_milliseconds,
+        }
+    ),
+    cv.only_on([PLATFORM_HOST]),
+)
+
+INTERRUPT_TRANSMIT_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.Optional(CONF_FREQUENCY, default="100kHz"): cv.All(cv.frequency, cv.Range(min=1e3, max=500e3)),
+            cv.Optional(CONF_QUEUE_SIZE, default=128): cv.All(validate_power_of_two, cv.int_range(min=16, max=4096)),
+        }
+    ),
+    cv.only_on([PLATFORM_ESP32, PLATFORM_ESP8266]),
+)
+
+
+def validate_interrupt_transmit(config):
+    if CONF_INTERRUPT_TRANSMIT in config and not config[CONF_FAST_GPIO]:
+        raise cv.Invalid(f"{CONF_INTERRUPT_TRANSMIT} requires {CONF_FAST_GPIO}.")
+    return config
+
+
+# sizes set by build flags, which hold for all displays: (option, sub-option)
+BUILD_FLAG_SIZES = [
+    (CONF_FEATURES, CONF_GLYPH_CACHE_SIZE),
+    (CONF_FEATURES, CONF_MESSAGE_QUEUE_SIZE),
+    (CONF_BUS_TRACE, CONF_SIZE),
+    (CONF_INTERRUPT_TRANSMIT, CONF_QUEUE_SIZE),
+]
+
+
+def final_validate_build_flag_sizes(config):
+    displays = [conf for conf in fv.full_config.get().get("display", []) if conf.get(CONF_PLATFORM) == "sda5708"]
+    for option, size in BUILD_FLAG_SIZES:
+        if option not in config:
+            continue
+        value = config[option][size]
+        for other in displays:
+            if option in other and other[option][size] != value:
+                raise cv.Invalid(
+                    f"{option}: {size} is {value}, but another sda5708 display uses {other[option][size]}. "
+                    "The size is compiled in for all displays, so it must be the same.",
+                    path=[option, size],
+                )
+    return config
+
+
+def final_validate_interrupt_transmit(config):
+    # the ESP8266 has a single usable timer, timer1, whose interrupt takes no argument
+    if CONF_INTERRUPT_TRANSMIT not in config or not CORE.is_esp8266:
+        return config
+    full_config = fv.full_config.get()
+    displays = [
+        conf for conf in full_config.get("display", [])
+        if conf.get(CONF_PLATFORM) == "sda5708" and CONF_INTERRUPT_TRANSMIT in conf
+    ]
+    if len(displays) > 1:
+        raise cv.Invalid(f"On ESP8266, only one display can use {CONF_INTERRUPT_TRANSMIT}.")
+    if any(conf.get(CONF_PLATFORM) == "esp8266_pwm" for conf in full_config.get("output", [])):
+        raise cv.Invalid(f"On ESP8266, {CONF_INTERRUPT_TRANSMIT} uses timer1 and cannot be used together with esp8266_pwm outputs.")
+    return config
+
+
+STREAM_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.Optional(CONF_UART_ID): cv.use_id(uart.UARTComponent),
+            cv.Optional(CONF_PORT): cv.All(cv.port, cv.requires_component("socket")),
+            cv.Optional(CONF_TIMEOUT, default="2s"): cv.positive_time_period_milliseconds,
+        }
+    ),
+    cv.has_exactly_one_key(CONF_UART_ID, CONF_PORT),
+)
+
+def validate_power(config):
+    if CONF_MAX_CURRENT in config and config[CONF_MAX_CURRENT] <= config[CONF_BASE_CURRENT]:
+        raise cv.Invalid(f"{CONF_MAX_CURRENT} must be greater than {CONF_BASE_CURRENT}.")
+    return config
+
+
+POWER_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.Optional(CONF_LED_CURRENT, default="1mA"): cv.current,
+            cv.Optional(CONF_BASE_CURRENT, default="10mA"): cv.current,
+            cv.Optional(CONF_MAX_CURRENT): cv.current,
+            cv.Optional(CONF_SENSOR): cv.All(
+                sensor.sensor_schema(
+                    unit_of_measurement=UNIT_AMPERE,
+                    accuracy_decimals=3,
+                    device_class=DEVICE_CLASS_CURRENT,
+                    state_class=STATE_CLASS_MEASUREMENT,
+                ),
+                cv.requires_component("sensor"),
+            ),
+        }
+    ),
+    validate_power,
+)
+
+FRAME_MIRROR_SCHEMA = cv.All(
+    text_sensor.text_sensor_schema(
+        icon="mdi:dots-grid",
+    ).extend(
+        {
+            cv.Optional(CONF_INTERVAL, default="1s"): cv.positive_time_period_milliseconds,
+            cv.Optional(CONF_DELTA, default=False): cv.boolean,
+        }
+    ),
+    cv.requires_component("text_sensor"),
+)
+
+PAGE_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(): cv.declare_id(SDAPage),
+        cv.Required(CONF_LAMBDA): cv.lambda_,
+    }
+)
+
+CONFIG_SCHEMA = cv.All(
     display.BASIC_DISPLAY_SCHEMA.extend(
         {
             cv.GenerateID(): cv.declare_id(SDADisplayComponent),
@@ -75,22 +733,75 @@ CONFIG_SCHEMA = (
             cv.Required(CONF_CLOCK_PIN): pins.gpio_output_pin_schema,
             cv.Required(CONF_LOAD_PIN): pins.gpio_output_pin_schema,
             cv.Required(CONF_RESET_PIN): pins.gpio_output_pin_schema,
+            cv.Optional(CONF_FAST_GPIO, default=True): cv.boolean,
 
             cv.Optional(CONF_BRIGHTNESS): cv.int_range(min=0, max=7),
             cv.Optional(CONF_LOW_PEAK_CURRENT): cv.boolean,
+            cv.Optional(CONF_AUTO_BRIGHTNESS): AUTO_BRIGHTNESS_SCHEMA,
+            cv.Optional(CONF_NIGHT_MODE): NIGHT_MODE_SCHEMA,
 
             cv.Optional(CONF_ROTATE_SCREEN): cv.boolean,
 
+            cv.Optional(CONF_PAGES): cv.All(cv.ensure_list(PAGE_SCHEMA), cv.Length(min=1)),
+            cv.GenerateID(CONF_LAYOUT_ID): cv.declare_id(SDALayout),
+            cv.Optional(CONF_LAYOUT): cv.All(cv.ensure_list(LAYOUT_FIELD_SCHEMA), cv.Length(min=1), validate_layout),
+
             cv.Optional(CONF_CUSTOM_GLYPHS): cv.ensure_list(CUSTOM_GLYPH_SCHEMA),
+            cv.Optional(CONF_FONT_BANKS): cv.ensure_list(FONT_BANK_SCHEMA),
+            cv.Optional(CONF_ANIMATIONS): cv.ensure_list(ANIMATION_SCHEMA),
+            cv.Optional(CONF_GRAPHS): cv.ensure_list(GRAPH_SCHEMA),
+            cv.Optional(CONF_SEQUENCES): cv.ensure_list(SEQUENCE_SCHEMA),
+
+            cv.Optional(CONF_MESSAGE_SCROLL_INTERVAL): cv.positive_time_period_milliseconds,
+
+            cv.Optional(CONF_ADAPTIVE_UPDATE): ADAPTIVE_UPDATE_SCHEMA,
+            cv.Optional(CONF_IDLE): IDLE_SCHEMA,
+            cv.Optional(CONF_SYNC): SYNC_SCHEMA,
+
+            cv.Optional(CONF_STREAM): STREAM_SCHEMA,
+            cv.Optional(CONF_FRAME_MIRROR): FRAME_MIRROR_SCHEMA,
+            cv.Optional(CONF_POWER): POWER_SCHEMA,
+
+            cv.Optional(CONF_FEATURES, default={}): FEATURES_SCHEMA,
+            cv.Optional(CONF_BUS_TRACE): BUS_TRACE_SCHEMA,
+            cv.Optional(CONF_VIRTUAL_SCREEN): VIRTUAL_SCREEN_SCHEMA,
+            cv.Optional(CONF_INTERRUPT_TRANSMIT): INTERRUPT_TRANSMIT_SCHEMA,
         }
     )
-    .extend(cv.polling_component_schema("1s"))
+    .extend(cv.polling_component_schema("1s")),
+    cv.has_at_most_one_key(CONF_PAGES, CONF_LAMBDA, CONF_LAYOUT),
+    validate_adaptive_update,
+    validate_features,
+    validate_interrupt_transmit,
+)
+
+FINAL_VALIDATE_SCHEMA = cv.All(
+    final_validate_build_flag_sizes,
+    final_validate_interrupt_transmit,
 )
 
 
 async def to_code(config):
     var = cg.new_Pvariable(config[CONF_ID])
-    await display.register_display(var, config)
+    # pages are SDA5708 pages, set up below. the display core would declare its own pages with the same IDs
+    await display.register_display(var, {key: value for key, value in config.items() if key != CONF_PAGES})
+
+    # build features, everything not enabled is left out of the build
+    features = config[CONF_FEATURES]
+    if features[CONF_PRINTF]:
+        cg.add_define("USE_SDA5708_PRINTF")
+    if features[CONF_STRFTIME]:
+        cg.add_define("USE_SDA5708_STRFTIME")
+    if features[CONF_CUSTOM_GLYPHS]:
+        cg.add_define("USE_SDA5708_CUSTOM_GLYPHS")
+    if features[CONF_ROTATION]:
+        cg.add_define("USE_SDA5708_ROTATION")
+    if features[CONF_PROPORTIONAL]:
+        cg.add_define("USE_SDA5708_PROPORTIONAL")
+    if features[CONF_FONT] == "full":
+        cg.add_define("USE_SDA5708_FULL_FONT")
+    cg.add_build_flag(f"-DSDA5708_GLYPH_CACHE_SIZE={features[CONF_GLYPH_CACHE_SIZE]}")
+    cg.add_build_flag(f"-DSDA5708_MESSAGE_QUEUE_SIZE={features[CONF_MESSAGE_QUEUE_SIZE]}")
 
     # pins
     pin_data = await cg.gpio_pin_expression(config[CONF_DATA_PIN])
@@ -102,6 +813,19 @@ async def to_code(config):
     cg.add(var.set_clock_pin(pin_clock))
     cg.add(var.set_load_pin(pin_load))
     cg.add(var.set_reset_pin(pin_reset))
+    cg.add(var.set_fast_gpio(config[CONF_FAST_GPIO]))
+
+    # fix the pins at compile time, so the transmit loop writes constant registers and masks.
+    # the pins are still checked at runtime, and use the generic path if they do not match
+    # build flags are global, so this only works for a single screen
+    single_display = count_displays() == 1
+    shift_pins = [config[CONF_DATA_PIN], config[CONF_CLOCK_PIN], config[CONF_LOAD_PIN]]
+    if single_display and config[CONF_FAST_GPIO] and all(is_register_pin(pin) for pin in shift_pins):
+        inverted = sum(1 << i for i, pin in enumerate(shift_pins) if pin[CONF_INVERTED])
+        cg.add_build_flag(f"-DSDA5708_FIXED_DATA_PIN={config[CONF_DATA_PIN][CONF_NUMBER]}")
+        cg.add_build_flag(f"-DSDA5708_FIXED_CLOCK_PIN={config[CONF_CLOCK_PIN][CONF_NUMBER]}")
+        cg.add_build_flag(f"-DSDA5708_FIXED_LOAD_PIN={config[CONF_LOAD_PIN][CONF_NUMBER]}")
+        cg.add_build_flag(f"-DSDA5708_FIXED_INVERTED_PINS={inverted}")
 
     # initial control register
     if CONF_LOW_PEAK_CURRENT in config:
@@ -109,8 +833,111 @@ async def to_code(config):
     if CONF_BRIGHTNESS in config:
         cg.add(var.set_init_brightness(config[CONF_BRIGHTNESS]))
 
+    if CONF_INTERRUPT_TRANSMIT in config:
+        transmit_config = config[CONF_INTERRUPT_TRANSMIT]
+        cg.add_define("USE_SDA5708_ISR_TRANSMIT")
+        cg.add_build_flag(f"-DSDA5708_SHIFT_QUEUE_SIZE={transmit_config[CONF_QUEUE_SIZE]}")
+        cg.add(var.set_shift_frequency(int(transmit_config[CONF_FREQUENCY])))
+
+    # rotation set in the configuration is fixed at compile time, unless screens may differ in rotation
     if CONF_ROTATE_SCREEN in config:
-        cg.add(var.set_rotate_screen(config[CONF_ROTATE_SCREEN]))
+        if single_display:
+            cg.add_build_flag(f"-DSDA5708_ROTATE_SCREEN={str(config[CONF_ROTATE_SCREEN]).lower()}")
+        else:
+            cg.add(var.set_rotate_screen(config[CONF_ROTATE_SCREEN]))
+
+    # brightness control
+    if CONF_AUTO_BRIGHTNESS in config:
+        auto_config = config[CONF_AUTO_BRIGHTNESS]
+        sens = await cg.get_variable(auto_config[CONF_SENSOR])
+        cg.add(var.set_illuminance_sensor(sens))
+        cg.add(var.set_auto_brightness_illuminance_range(
+            auto_config[CONF_MIN_ILLUMINANCE], 
+            auto_config[CONF_MAX_ILLUMINANCE]
+        ))
+        cg.add(var.set_auto_brightness_range(
+            auto_config[CONF_MIN_BRIGHTNESS], 
+            auto_config[CONF_MAX_BRIGHTNESS]
+        ))
+        cg.add(var.set_auto_brightness_hysteresis(auto_config[CONF_HYSTERESIS]))
+        cg.add(var.set_auto_brightness_step_interval(auto_config[CONF_STEP_INTERVAL]))
+
+    if CONF_NIGHT_MODE in config:
+        night_config = config[CONF_NIGHT_MODE]
+        rtc = await cg.get_variable(night_config[CONF_TIME_ID])
+        cg.add(var.set_night_mode_time(rtc))
+        cg.add(var.set_night_mode_schedule(
+            night_config[CONF_START], 
+            night_config[CONF_END], 
+            night_config[CONF_BRIGHTNESS]
+        ))
+
+    if CONF_MESSAGE_SCROLL_INTERVAL in config:
+        cg.add(var.set_message_scroll_interval(config[CONF_MESSAGE_SCROLL_INTERVAL]))
+
+    # power saving
+    if CONF_ADAPTIVE_UPDATE in config:
+        adaptive_config = config[CONF_ADAPTIVE_UPDATE]
+        cg.add(var.set_adaptive_update(
+            adaptive_config[CONF_MAX_INTERVAL],
+            adaptive_config[CONF_STATIC_UPDATES]
+        ))
+
+    if CONF_IDLE in config:
+        idle_config = config[CONF_IDLE]
+        cg.add(var.set_idle_timeout(idle_config[CONF_TIMEOUT].total_milliseconds))
+        if CONF_BRIGHTNESS in idle_config:
+            cg.add(var.set_idle_brightness(idle_config[CONF_BRIGHTNESS]))
+
+    # synchronized presentation
+    if CONF_SYNC in config:
+        sync_config = config[CONF_SYNC]
+        cg.add_define("USE_SDA5708_SYNC")
+        rtc = await cg.get_variable(sync_config[CONF_TIME_ID])
+        cg.add(var.set_sync(rtc, sync_config[CONF_INTERVAL], sync_config[CONF_LEAD]))
+
+    # stream ingest
+    if CONF_STREAM in config:
+        stream_config = config[CONF_STREAM]
+        cg.add(var.set_stream_timeout(stream_config[CONF_TIMEOUT]))
+        if CONF_UART_ID in stream_config:
+            cg.add_define("USE_SDA5708_STREAM_UART")
+            uart_ = await cg.get_variable(stream_config[CONF_UART_ID])
+            cg.add(var.set_stream_uart(uart_))
+        if CONF_PORT in stream_config:
+            cg.add_define("USE_SDA5708_STREAM_SOCKET")
+            cg.add(var.set_stream_port(stream_config[CONF_PORT]))
+
+    # current estimation
+    if CONF_POWER in config:
+        power_config = config[CONF_POWER]
+        cg.add(var.set_power_estimation(power_config[CONF_LED_CURRENT], power_config[CONF_BASE_CURRENT]))
+        if CONF_MAX_CURRENT in power_config:
+            cg.add(var.set_max_current(power_config[CONF_MAX_CURRENT]))
+        if CONF_SENSOR in power_config:
+            sens = await sensor.new_sensor(power_config[CONF_SENSOR])
+            cg.add(var.set_current_sensor(sens))
+
+    # bus trace
+    if CONF_BUS_TRACE in config:
+        cg.add_define("USE_SDA5708_BUS_TRACE")
+        cg.add_build_flag(f"-DSDA5708_BUS_TRACE_SIZE={config[CONF_BUS_TRACE][CONF_SIZE]}")
+
+    # virtual screen
+    if CONF_VIRTUAL_SCREEN in config:
+        virtual_config = config[CONF_VIRTUAL_SCREEN]
+        cg.add_define("USE_SDA5708_VIRTUAL_SCREEN")
+        cg.add(var.set_virtual_screen_interval(virtual_config[CONF_INTERVAL]))
+        if CONF_FILE in virtual_config:
+            cg.add(var.set_virtual_screen_file(virtual_config[CONF_FILE]))
+
+    # frame mirror
+    if CONF_FRAME_MIRROR in config:
+        mirror_config = config[CONF_FRAME_MIRROR]
+        sens = await text_sensor.new_text_sensor(mirror_config)
+        cg.add(var.set_mirror_sensor(sens))
+        cg.add(var.set_mirror_interval(mirror_config[CONF_INTERVAL]))
+        cg.add(var.set_mirror_delta(mirror_config[CONF_DELTA]))
 
     # rendering
     if CONF_LAMBDA in config:
@@ -121,17 +948,75 @@ async def to_code(config):
         )
         cg.add(var.set_writer(lambda_))
 
+    if CONF_PAGES in config:
+        for page_config in config[CONF_PAGES]:
+            lambda_ = await cg.process_lambda(
+                page_config[CONF_LAMBDA],
+                [(SDADisplayComponent.operator("ref"), "it")],
+                return_type=cg.void
+            )
+            page = cg.new_Pvariable(page_config[CONF_ID], lambda_)
+            cg.add(var.add_page(page))
+
+    if CONF_LAYOUT in config:
+        layout = cg.new_Pvariable(config[CONF_LAYOUT_ID])
+        for field_config in config[CONF_LAYOUT]:
+            await layout_field_to_code(layout, field_config)
+        cg.add(var.set_layout(layout))
+
     # custom glyphs
     if CONF_CUSTOM_GLYPHS in config:
         for glyph_config in config[CONF_CUSTOM_GLYPHS]:
             char_expr, glyph_expr = await custom_glyph_to_code(glyph_config)
             cg.add(var.get_font().set_glyph(char_expr, glyph_expr))
 
+    # font banks
+    flash_data = 0
+    if CONF_FONT_BANKS in config:
+        for bank_config in config[CONF_FONT_BANKS]:
+            flash_data += await font_bank_to_code(bank_config)
 
-async def custom_glyph_to_code(config):
-    char = config[CONF_GLYPH_CHAR]
-    glyph = config[CONF_GLYPH_GLYPH]
+    # animations
+    if CONF_ANIMATIONS in config:
+        for animation_config in config[CONF_ANIMATIONS]:
+            flash_data += await animation_to_code(animation_config)
+
+    # graphs
+    if CONF_GRAPHS in config:
+        for graph_config in config[CONF_GRAPHS]:
+            graph = cg.new_Pvariable(
+                graph_config[CONF_ID],
+                graph_config[CONF_TYPE],
+                graph_config[CONF_MIN_VALUE],
+                graph_config[CONF_MAX_VALUE],
+            )
+            if CONF_SENSOR in graph_config:
+                sens = await cg.get_variable(graph_config[CONF_SENSOR])
+                cg.add(var.add_graph_sensor(graph, sens))
 
+    # sequences
+    if CONF_SEQUENCES in config:
+        for sequence_config in config[CONF_SEQUENCES]:
+            sequence = cg.new_Pvariable(sequence_config[CONF_ID])
+            for step_config in sequence_config[CONF_STEPS]:
+                cg.add(sequence.add_step(*sequence_step_to_code(step_config)))
+
+    # footprint report, the total RAM and flash use is reported by the build itself
+    _LOGGER.info(
+        "%s: features %s, %s font, %d glyph cache slots (%d bytes RAM), %d message queue entries, "
+        "%d bytes of font bank and animation data in flash",
+        config[CONF_ID],
+        ", ".join(f for f in (CONF_PRINTF, CONF_STRFTIME, CONF_CUSTOM_GLYPHS, CONF_ROTATION, CONF_PROPORTIONAL) if features[f]) or "none",
+        features[CONF_FONT],
+        features[CONF_GLYPH_CACHE_SIZE],
+        features[CONF_GLYPH_CACHE_SIZE] * GLYPH_CACHE_SLOT_SIZE,
+        features[CONF_MESSAGE_QUEUE_SIZE],
+        flash_data,
+    )
+
+
+def glyph_to_rows(glyph):
+    # convert a glyph drawn as 7 strings into 7 row bytes
     glyph_data = []
     for row in glyph:
         row_data = 0
@@ -139,12 +1024,154 @@ async def custom_glyph_to_code(config):
             if c == '#':
                 row_data |= (1 << (4 - i))
         glyph_data.append(row_data)
-    
+    return glyph_data
+
+
+async def custom_glyph_to_code(config):
+    char = config[CONF_GLYPH_CHAR]
+    glyph_data = glyph_to_rows(config[CONF_GLYPH_GLYPH])
+
     char_expr = cg.RawExpression(f"'{char}'")
     glyph_expr = cg.RawExpression(f"{{{', '.join(f'0b{row:05b}' for row in glyph_data)}}}")
     return char_expr, glyph_expr
 
 
+async def layout_field_to_code(layout, config):
+    # every field becomes a typed entry bound to its source, no lambda is involved
+    pos = config[CONF_POSITION]
+    width = config[CONF_WIDTH]
+    align = LAYOUT_ALIGNS[config[CONF_ALIGN]]
+
+    if CONF_TEXT in config:
+        cg.add(layout.add_text(pos, width, config[CONF_TEXT]))
+    elif CONF_ICON in config:
+        code = glyph_char_code(config[CONF_ICON])
+        cg.add(layout.add_text(pos, width, cg.RawExpression(f'"\\x{code:02x}"')))
+    elif CONF_SENSOR in config:
+        sens = await cg.get_variable(config[CONF_SENSOR])
+        cg.add(layout.add_sensor(pos, width, align, config[CONF_FORMAT], sens))
+    elif CONF_TIME_ID in config:
+        rtc = await cg.get_variable(config[CONF_TIME_ID])
+        cg.add(layout.add_time(pos, width, align, config[CONF_FORMAT], rtc))
+
+
+def sequence_step_to_code(config):
+    # (type, text, duration or interval, count or brightness)
+    if CONF_SHOW in config:
+        show = config[CONF_SHOW]
+        return SDASequenceStepType.SHOW, show[CONF_TEXT], show[CONF_DURATION], 0
+    if CONF_SCROLL in config:
+        scroll = config[CONF_SCROLL]
+        return SDASequenceStepType.SCROLL, scroll[CONF_TEXT], scroll[CONF_INTERVAL], 0
+    if CONF_BLINK in config:
+        blink = config[CONF_BLINK]
+        return SDASequenceStepType.BLINK, blink[CONF_TEXT], blink[CONF_PERIOD], blink[CONF_COUNT]
+    if CONF_FADE in config:
+        fade = config[CONF_FADE]
+        return SDASequenceStepType.FADE, cg.nullptr, fade[CONF_DURATION], fade[CONF_BRIGHTNESS]
+    return SDASequenceStepType.WAIT, cg.nullptr, config[CONF_WAIT], 0
+
+
+def load_animation_frames(path):
+    # load frames from an image file. every frame must be 40x7 pixels.
+    # animated images (e.g. GIF) use one image frame per animation frame,
+    # still images (e.g. PNG strips) place the frames next to each other horizontally.
+    from PIL import Image, ImageSequence
+
+    frames = []
+    with Image.open(path) as image:
+        for image_frame in ImageSequence.Iterator(image):
+            image_frame = image_frame.convert("L")
+            width, height = image_frame.size
+            if height != GLYPH_ROWS or width % SCREEN_COLS != 0:
+                raise core.EsphomeError(
+                    f"Animation image '{path}' must be {GLYPH_ROWS} pixels high and a multiple of {SCREEN_COLS} pixels wide, "
+                    f"got {width}x{height}."
+                )
+
+            pixels = image_frame.load()
+            for x0 in range(0, width, SCREEN_COLS):
+                frames.append([
+                    "".join('#' if pixels[x0 + x, y] >= 128 else ' ' for x in range(SCREEN_COLS))
+                    for y in range(GLYPH_ROWS)
+                ])
+
+    return frames
+
+
+async def font_bank_to_code(config):
+    # 256 byte index from character to glyph number (0xFF: not defined), followed by the glyph rows
+    index = [0xFF] * 256
+    rows = []
+    for number, glyph_config in enumerate(config[CONF_GLYPHS]):
+        index[glyph_char_code(glyph_config[CONF_GLYPH_CHAR])] = number
+        rows.extend(glyph_to_rows(glyph_config[CONF_GLYPH_GLYPH]))
+
+    # returns the size of the flash data, for the footprint report
+    data = index + rows
+    prog_arr = cg.progmem_array(config[CONF_RAW_DATA_ID], data)
+    cg.new_Pvariable(config[CONF_ID], prog_arr)
+    return len(data)
+
+
+def frame_to_glyphs(frame):
+    # convert a 40x7 frame into 8 glyphs of 7 row bytes each
+    glyphs = []
+    for digit in range(SCREEN_DIGITS):
+        glyph = []
+        for row in frame:
+            row_data = 0
+            for i, c in enumerate(row[digit * GLYPH_COLS:(digit + 1) * GLYPH_COLS]):
+                if c == '#':
+                    row_data |= (1 << (4 - i))
+            glyph.append(row_data)
+        glyphs.append(glyph)
+    return glyphs
+
+
+def encode_animation(frames, delta_encode):
+    # encode frames into the packed stream expected by SDAAnimation
+    data = []
+    previous = None
+    for frame in frames:
+        glyphs = frame_to_glyphs(frame)
+        if not delta_encode:
+            for glyph in glyphs:
+                data.extend(glyph)
+            continue
+
+        changed = 0
+        for digit, glyph in enumerate(glyphs):
+            if previous is None or previous[digit] != glyph:
+                changed |= (1 << digit)
+
+        data.append(changed)
+        for digit, glyph in enumerate(glyphs):
+            if changed & (1 << digit):
+                data.extend(glyph)
+        previous = glyphs
+    return data
+
+
+async def animation_to_code(config):
+    if CONF_FILE in config:
+        frames = load_animation_frames(config[CONF_FILE])
+    else:
+        frames = config[CONF_FRAMES]
+
+    # returns the size of the flash data, for the footprint report
+    data = encode_animation(frames, config[CONF_DELTA_ENCODE])
+    prog_arr = cg.progmem_array(config[CONF_RAW_DATA_ID], data)
+    cg.new_Pvariable(
+        config[CONF_ID],
+        prog_arr,
+        len(frames),
+        config[CONF_FRAME_DURATION].total_milliseconds,
+        config[CONF_DELTA_ENCODE],
+    )
+    return len(data)
+
+
 @automation.register_action(
     "sda5708.set_brightness",
     SetBrightnessAction,
@@ -167,3 +1194,420 @@ async def sda5708_set_brightness_to_code(
     template_ = await cg.templatable(config[CONF_BRIGHTNESS], args, cg.uint8)
     cg.add(var.set_brightness(template_))
     return var
+
+
+@automation.register_action(
+    "sda5708.fade_brightness",
+    FadeBrightnessAction,
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.use_id(SDADisplayComponent),
+            cv.Required(CONF_BRIGHTNESS): cv.templatable(cv.int_range(min=0, max=7)),
+            cv.Optional(CONF_DURATION, default="1s"): cv.templatable(cv.positive_time_period_milliseconds),
+        }
+    ),
+)
+async def sda5708_fade_brightness_to_code(
+    config: ConfigType,
+    action_id: ID,
+    template_arg: cg.TemplateArguments,
+    args: TemplateArgsType,
+) -> MockObj:
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+    template_ = await cg.templatable(config[CONF_BRIGHTNESS], args, cg.uint8)
+    cg.add(var.set_brightness(template_))
+    template_ = await cg.templatable(config[CONF_DURATION], args, cg.uint32)
+    cg.add(var.set_duration(template_))
+    return var
+
+
+@automation.register_action(
+    "sda5708.set_auto_brightness",
+    SetAutoBrightnessAction,
+    cv.maybe_simple_value(
+        {
+            cv.GenerateID(): cv.use_id(SDADisplayComponent),
+            cv.Required(CONF_ENABLED): cv.templatable(cv.boolean),
+        },
+        key=CONF_ENABLED,
+    ),
+)
+async def sda5708_set_auto_brightness_to_code(
+    config: ConfigType,
+    action_id: ID,
+    template_arg: cg.TemplateArguments,
+    args: TemplateArgsType,
+) -> MockObj:
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+    template_ = await cg.templatable(config[CONF_ENABLED], args, bool)
+    cg.add(var.set_enabled(template_))
+    return var
+
+
+@automation.register_action(
+    "sda5708.wake",
+    WakeAction,
+    automation.maybe_simple_id(
+        {
+            cv.GenerateID(): cv.use_id(SDADisplayComponent),
+        }
+    ),
+)
+async def sda5708_wake_to_code(
+    config: ConfigType,
+    action_id: ID,
+    template_arg: cg.TemplateArguments,
+    args: TemplateArgsType,
+) -> MockObj:
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+    return var
+
+
+@automation.register_action(
+    "sda5708.play_animation",
+    PlayAnimationAction,
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.use_id(SDADisplayComponent),
+            cv.Required(CONF_ANIMATION): cv.use_id(SDAAnimation),
+            cv.Optional(CONF_LOOP, default=False): cv.templatable(cv.boolean),
+        }
+    ),
+)
+async def sda5708_play_animation_to_code(
+    config: ConfigType,
+    action_id: ID,
+    template_arg: cg.TemplateArguments,
+    args: TemplateArgsType,
+) -> MockObj:
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+    animation = await cg.get_variable(config[CONF_ANIMATION])
+    cg.add(var.set_animation(animation))
+    template_ = await cg.templatable(config[CONF_LOOP], args, bool)
+    cg.add(var.set_loop(template_))
+    return var
+
+
+@automation.register_action(
+    "sda5708.stop_animation",
+    StopAnimationAction,
+    automation.maybe_simple_id(
+        {
+            cv.GenerateID(): cv.use_id(SDADisplayComponent),
+        }
+    ),
+)
+async def sda5708_stop_animation_to_code(
+    config: ConfigType,
+    action_id: ID,
+    template_arg: cg.TemplateArguments,
+    args: TemplateArgsType,
+) -> MockObj:
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+    return var
+
+
+@automation.register_action(
+    "sda5708.run_sequence",
+    RunSequenceAction,
+    cv.maybe_simple_value(
+        {
+            cv.GenerateID(): cv.use_id(SDADisplayComponent),
+            cv.Required(CONF_SEQUENCE): cv.use_id(SDASequence),
+        },
+        key=CONF_SEQUENCE,
+    ),
+)
+async def sda5708_run_sequence_to_code(
+    config: ConfigType,
+    action_id: ID,
+    template_arg: cg.TemplateArguments,
+    args: TemplateArgsType,
+) -> MockObj:
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+    sequence = await cg.get_variable(config[CONF_SEQUENCE])
+    cg.add(var.set_sequence(sequence))
+    return var
+
+
+@automation.register_action(
+    "sda5708.stop_sequence",
+    StopSequenceAction,
+    automation.maybe_simple_id(
+        {
+            cv.GenerateID(): cv.use_id(SDADisplayComponent),
+        }
+    ),
+)
+async def sda5708_stop_sequence_to_code(
+    config: ConfigType,
+    action_id: ID,
+    template_arg: cg.TemplateArguments,
+    args: TemplateArgsType,
+) -> MockObj:
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+    return var
+
+
+@automation.register_action(
+    "sda5708.show_message",
+    ShowMessageAction,
+    cv.maybe_simple_value(
+        {
+            cv.GenerateID(): cv.use_id(SDADisplayComponent),
+            cv.Required(CONF_TEXT): cv.templatable(cv.string),
+            cv.Optional(CONF_PRIORITY, default=0): cv.templatable(cv.uint8_t),
+            cv.Optional(CONF_DURATION, default="5s"): cv.templatable(cv.positive_time_period_milliseconds),
+            cv.Optional(CONF_SCROLL, default=False): cv.templatable(cv.boolean),
+            cv.Optional(CONF_EXPIRY, default="0s"): cv.templatable(cv.positive_time_period_milliseconds),
+        },
+        key=CONF_TEXT,
+    ),
+)
+async def sda5708_show_message_to_code(
+    config: ConfigType,
+    action_id: ID,
+    template_arg: cg.TemplateArguments,
+    args: TemplateArgsType,
+) -> MockObj:
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+    template_ = await cg.templatable(config[CONF_TEXT], args, cg.std_string)
+    cg.add(var.set_text(template_))
+    template_ = await cg.templatable(config[CONF_PRIORITY], args, cg.uint8)
+    cg.add(var.set_priority(template_))
+    template_ = await cg.templatable(config[CONF_DURATION], args, cg.uint32)
+    cg.add(var.set_duration(template_))
+    template_ = await cg.templatable(config[CONF_SCROLL], args, bool)
+    cg.add(var.set_scroll(template_))
+    template_ = await cg.templatable(config[CONF_EXPIRY], args, cg.uint32)
+    cg.add(var.set_expiry(template_))
+    return var
+
+
+@automation.register_action(
+    "sda5708.clear_messages",
+    ClearMessagesAction,
+    automation.maybe_simple_id(
+        {
+            cv.GenerateID(): cv.use_id(SDADisplayComponent),
+        }
+    ),
+)
+async def sda5708_clear_messages_to_code(
+    config: ConfigType,
+    action_id: ID,
+    template_arg: cg.TemplateArguments,
+    args: TemplateArgsType,
+) -> MockObj:
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+    return var
+
+
+@automation.register_action(
+    "sda5708.show_page",
+    ShowPageAction,
+    cv.maybe_simple_value(
+        {
+            cv.GenerateID(): cv.use_id(SDADisplayComponent),
+            cv.Required(CONF_PAGE_ID): cv.use_id(SDAPage),
+        },
+        key=CONF_PAGE_ID,
+    ),
+)
+async def sda5708_show_page_to_code(
+    config: ConfigType,
+    action_id: ID,
+    template_arg: cg.TemplateArguments,
+    args: TemplateArgsType,
+) -> MockObj:
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+    page = await cg.get_variable(config[CONF_PAGE_ID])
+    cg.add(var.set_page(page))
+    return var
+
+
+@automation.register_action(
+    "sda5708.set_font_bank",
+    SetFontBankAction,
+    cv.maybe_simple_value(
+        {
+            cv.GenerateID(): cv.use_id(SDADisplayComponent),
+            cv.Optional(CONF_FONT_BANK): cv.use_id(SDAFontBank),
+        },
+        key=CONF_FONT_BANK,
+    ),
+)
+async def sda5708_set_font_bank_to_code(
+    config: ConfigType,
+    action_id: ID,
+    template_arg: cg.TemplateArguments,
+    args: TemplateArgsType,
+) -> MockObj:
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+    if CONF_FONT_BANK in config:
+        bank = await cg.get_variable(config[CONF_FONT_BANK])
+        cg.add(var.set_bank(bank))
+    return var
+
+
+@automation.register_action(
+    "sda5708.set_glyph",
+    SetGlyphAction,
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.use_id(SDADisplayComponent),
+            cv.Required(CONF_KEY): cv.templatable(cv.string),
+            cv.Required(CONF_ROWS): cv.templatable(
+                cv.All(cv.ensure_list(cv.int_range(min=0, max=0b11111)), cv.Length(min=GLYPH_ROWS, max=GLYPH_ROWS))
+            ),
+        }
+    ),
+)
+async def sda5708_set_glyph_to_code(
+    config: ConfigType,
+    action_id: ID,
+    template_arg: cg.TemplateArguments,
+    args: TemplateArgsType,
+) -> MockObj:
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+    template_ = await cg.templatable(config[CONF_KEY], args, cg.const_char_ptr)
+    cg.add(var.set_key(template_))
+    # a braced list cannot be passed to the templated setter, so constant rows are spelled out as a glyph
+    template_ = await cg.templatable(
+        config[CONF_ROWS],
+        args,
+        SDAGlyph,
+        to_exp=lambda rows: cg.RawExpression(f"{SDAGlyph}{{{', '.join(f'0b{row:05b}' for row in rows)}}}"),
+    )
+    cg.add(var.set_rows(template_))
+    return var
+
+
+@automation.register_action(
+    "sda5708.benchmark",
+    BenchmarkAction,
+    cv.maybe_simple_value(
+        {
+            cv.GenerateID(): cv.use_id(SDADisplayComponent),
+            cv.Optional(CONF_FRAMES, default=100): cv.templatable(cv.int_range(min=1, max=10000)),
+        },
+        key=CONF_FRAMES,
+    ),
+)
+async def sda5708_benchmark_to_code(
+    config: ConfigType,
+    action_id: ID,
+    template_arg: cg.TemplateArguments,
+    args: TemplateArgsType,
+) -> MockObj:
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+    template_ = await cg.templatable(config[CONF_FRAMES], args, cg.uint16)
+    cg.add(var.set_frames(template_))
+    return var
+
+
+@automation.register_action(
+    "sda5708.dump_bus_trace",
+    DumpBusTraceAction,
+    automation.maybe_simple_id(
+        {
+            cv.GenerateID(): cv.use_id(SDADisplayComponent),
+        }
+    ),
+)
+async def sda5708_dump_bus_trace_to_code(
+    config: ConfigType,
+    action_id: ID,
+    template_arg: cg.TemplateArguments,
+    args: TemplateArgsType,
+) -> MockObj:
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+    return var
+
+
+@automation.register_action(
+    "sda5708.next_page",
+    NextPageAction,
+    automation.maybe_simple_id(
+        {
+            cv.GenerateID(): cv.use_id(SDADisplayComponent),
+        }
+    ),
+)
+async def sda5708_next_page_to_code(
+    config: ConfigType,
+    action_id: ID,
+    template_arg: cg.TemplateArguments,
+    args: TemplateArgsType,
+) -> MockObj:
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+    return var
+
+
+@automation.register_action(
+    "sda5708.previous_page",
+    PreviousPageAction,
+    automation.maybe_simple_id(
+        {
+            cv.GenerateID(): cv.use_id(SDADisplayComponent),
+        }
+    ),
+)
+async def sda5708_previous_page_to_code(
+    config: ConfigType,
+    action_id: ID,
+    template_arg: cg.TemplateArguments,
+    args: TemplateArgsType,
+) -> MockObj:
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+    return var
+
+
+@automation.register_action(
+    "sda5708.set_digit_attributes",
+    SetDigitAttributesAction,
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.use_id(SDADisplayComponent),
+            cv.Required(CONF_DIGIT): cv.templatable(cv.int_range(min=0, max=7)),
+            cv.Optional(CONF_BLINK_PERIOD, default="0ms"): cv.templatable(
+                cv.All(cv.positive_time_period_milliseconds, cv.Range(max=cv.TimePeriod(milliseconds=65535)))
+            ),
+            cv.Optional(CONF_INVERT, default=False): cv.templatable(cv.boolean),
+            cv.Optional(CONF_UNDERLINE, default=False): cv.templatable(cv.boolean),
+        }
+    ),
+)
+async def sda5708_set_digit_attributes_to_code(
+    config: ConfigType,
+    action_id: ID,
+    template_arg: cg.TemplateArguments,
+    args: TemplateArgsType,
+) -> MockObj:
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+    template_ = await cg.templatable(config[CONF_DIGIT], args, cg.uint8)
+    cg.add(var.set_digit(template_))
+    template_ = await cg.templatable(config[CONF_BLINK_PERIOD], args, cg.uint16)
+    cg.add(var.set_blink_period(template_))
+    template_ = await cg.templatable(config[CONF_INVERT], args, bool)
+    cg.add(var.set_invert(template_))
+    template_ = await cg.templatable(config[CONF_UNDERLINE], args, bool)
+    cg.add(var.set_underline(template_))
+    return var
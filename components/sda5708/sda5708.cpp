@@ -1,5 +1,9 @@
 #include "sda5708.h"
 
+#include <algorithm>
+#include <cinttypes>
+#include <cstring>
+
 #include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
 
@@ -22,7 +26,104 @@ namespace esphome::sda5708
     this->reset_pin_->setup();             // OUTPUT
     this->reset_pin_->digital_write(true); // active LOW
 
+#ifdef USE_SDA5708_FAST_GPIO
+    if (this->fast_gpio_enabled_)
+      setup_fast_gpio();
+#endif
+
+#ifdef USE_SDA5708_ISR_TRANSMIT
+    if (this->shift_frequency_ != 0)
+    {
+      if (this->fast_gpio_)
+        setup_shift_timer();
+      else
+        ESP_LOGW(TAG, "Interrupt transmit requires all pins to be internal GPIOs, using blocking transmit");
+    }
+#endif
+
     this->screen_reset();
+
+#ifdef USE_SDA5708_SYNC
+    // content is rendered ahead of each presentation time instead of on the update interval
+    if (this->sync_time_ != nullptr)
+      this->set_update_interval(SCHEDULER_DONT_RUN);
+#endif
+
+    this->base_update_interval_ = this->get_update_interval();
+    this->last_activity_ = millis();
+
+#ifdef USE_SENSOR
+    if (this->illuminance_sensor_ != nullptr)
+      this->illuminance_sensor_->add_on_state_callback([this](float state) { this->on_illuminance(state); });
+#endif
+
+    if (this->night_mode_)
+      this->set_interval("night_mode", 10000, [this]() { this->check_night_mode(); });
+
+#ifdef USE_SDA5708_STREAM_SOCKET
+    if (this->stream_port_ != 0)
+      setup_stream_socket();
+#endif
+  }
+
+  void SDA5708Component::loop()
+  {
+    const uint32_t now = millis();
+
+#ifdef USE_SDA5708_SYNC
+    if (this->sync_time_ != nullptr)
+      process_sync();
+#endif
+
+    if (this->fade_active_)
+      process_fade(now);
+
+    process_stream(now);
+
+    if (this->mirror_pending_)
+      process_mirror(now);
+
+    if (this->power_estimation_)
+      process_power(now);
+
+#ifdef USE_SDA5708_VIRTUAL_SCREEN
+    process_virtual_screen(now);
+#endif
+
+    if (this->idle_timeout_ != 0 && !this->idle_ && now - this->last_activity_ >= this->idle_timeout_)
+      enter_idle();
+
+    // a running sequence owns the screen, messages and animations wait for it to finish
+    if (this->sequence_ != nullptr && !this->stream_active_)
+      process_sequence(now);
+
+    if (this->message_active_ && this->sequence_ == nullptr)
+      process_messages(now);
+
+    if (this->animation_ != nullptr && this->sequence_ == nullptr && now - this->animation_frame_start_ >= this->animation_->get_frame_duration())
+    {
+      this->animation_frame_start_ = now;
+      write_next_animation_frame();
+    }
+
+    // graphs are sent as they change, while the content they are part of is shown
+    if (this->graph_ != nullptr && this->graph_->is_dirty() && !this->message_active_)
+      apply_graph();
+
+    // sensor fields of the layout are sent as they change
+    if (this->layout_ != nullptr && this->layout_->is_dirty() && !this->message_active_ && this->automatic_redraw_skip_frames_ == 0)
+      apply_layout(false);
+
+    // apply blinking and attribute changes, unless an animation, a sequence or the stream owns the screen
+    if (this->animation_ == nullptr && this->sequence_ == nullptr && !this->stream_active_ && (this->blink_digits_ != 0 || this->layers_dirty_))
+    {
+      const uint8_t visible = get_blink_visible(now);
+      if (this->layers_dirty_ || visible != this->blink_visible_)
+      {
+        this->blink_visible_ = visible;
+        present();
+      }
+    }
   }
 
   void SDA5708Component::dump_config()
@@ -34,26 +135,100 @@ namespace esphome::sda5708
     LOG_PIN("  Reset Pin: ", this->reset_pin_);
     ESP_LOGCONFIG(TAG, "  Initial Brightness: %u", this->init_brightness_);
     ESP_LOGCONFIG(TAG, "  Initial Peak Current: %s", this->init_peak_current_ ? "12.5%" : "Maximum");
+#if defined(USE_SDA5708_VIRTUAL_SCREEN)
+    ESP_LOGCONFIG(TAG, "  Transport: virtual screen (%s)",
+                  this->virtual_screen_file_.empty() ? "terminal" : this->virtual_screen_file_.c_str());
+#elif defined(USE_SDA5708_ISR_TRANSMIT)
+    if (this->shift_ready_)
+      ESP_LOGCONFIG(TAG, "  Transport: transmit interrupt at %" PRIu32 " Hz", this->shift_frequency_);
+    else
+      ESP_LOGCONFIG(TAG, "  Transport: %s", this->fast_gpio_ ? "direct GPIO registers" : "generic GPIO");
+#elif defined(USE_SDA5708_FIXED_GPIO)
+    ESP_LOGCONFIG(TAG, "  Transport: %s", this->fast_gpio_ ? "fixed GPIO registers" : "generic GPIO");
+#elif defined(USE_SDA5708_FAST_GPIO)
+    ESP_LOGCONFIG(TAG, "  Transport: %s", this->fast_gpio_ ? "direct GPIO registers" : "generic GPIO");
+#else
+    ESP_LOGCONFIG(TAG, "  Transport: generic GPIO");
+#endif
+#ifdef USE_SDA5708_ROTATION
+    ESP_LOGCONFIG(TAG, "  Rotate Screen: %s", this->rotate_screen_ ? "yes" : "no");
+#endif
+    if (this->auto_brightness_)
+    {
+      ESP_LOGCONFIG(TAG, "  Auto Brightness: %u-%u for %.1f-%.1f lx", this->auto_brightness_min_, this->auto_brightness_max_,
+                    this->auto_brightness_min_illuminance_, this->auto_brightness_max_illuminance_);
+    }
+    if (this->night_mode_)
+    {
+      ESP_LOGCONFIG(TAG, "  Night Mode: %02u:%02u-%02u:%02u at brightness %u",
+                    this->night_mode_start_ / 60, this->night_mode_start_ % 60,
+                    this->night_mode_end_ / 60, this->night_mode_end_ % 60, this->night_mode_brightness_);
+    }
+    if (this->power_estimation_)
+    {
+      ESP_LOGCONFIG(TAG, "  Current Estimation: %.1f mA per pixel, %.1f mA base", this->led_current_ * 1000.0f,
+                    this->base_current_ * 1000.0f);
+      if (this->max_current_ > 0.0f)
+        ESP_LOGCONFIG(TAG, "  Current Budget: %.1f mA", this->max_current_ * 1000.0f);
+    }
+#ifdef USE_SDA5708_SYNC
+    if (this->sync_time_ != nullptr)
+      ESP_LOGCONFIG(TAG, "  Synchronized Presentation: every %" PRIu32 " ms, rendered %" PRIu32 " ms ahead", this->sync_interval_,
+                    this->sync_lead_);
+#endif
+#ifdef USE_SDA5708_STREAM_UART
+    if (this->stream_uart_ != nullptr)
+      ESP_LOGCONFIG(TAG, "  Stream: UART");
+#endif
+#ifdef USE_SDA5708_STREAM_SOCKET
+    if (this->stream_port_ != 0)
+      ESP_LOGCONFIG(TAG, "  Stream: TCP port %u", this->stream_port_);
+#endif
+    ESP_LOGCONFIG(TAG, "  Footprint: %u bytes RAM, %u built-in glyphs, %u glyph cache slots",
+                  static_cast<unsigned>(sizeof(*this)), static_cast<unsigned>(DEFAULT_FONT_SIZE),
+                  static_cast<unsigned>(SDAGlyphCache::SIZE));
     LOG_UPDATE_INTERVAL(this);
   }
 
   void SDA5708Component::update()
   {
-    // writer set and auto-redraw enabled?
-    if (this->writer_.has_value() && this->automatic_redraw_skip_frames_ == 0)
+    // animations, sequences, messages and the stream own the screen while active
+    if (this->animation_ != nullptr || this->sequence_ != nullptr || this->message_active_ || this->stream_active_)
+      return;
+
+    const SDAPackedFrame previous = this->base_frame_;
+
+    // auto-redraw enabled?
+    if (this->automatic_redraw_skip_frames_ == 0 && this->page_ != nullptr)
     {
-      clear();
-      (*this->writer_)(*this);
+      render_active_page();
     }
-
-    // decrement auto-redraw
-    if (this->automatic_redraw_skip_frames_ > 0)
+    else if (this->automatic_redraw_skip_frames_ == 0 && this->layout_ != nullptr)
     {
-      this->automatic_redraw_skip_frames_--;
+      // only fields whose source changed are formatted and rendered again
+      apply_layout(true);
+      if (this->layers_dirty_)
+        present();
     }
+    else
+    {
+      if (this->automatic_redraw_skip_frames_ == 0 && this->writer_.has_value())
+      {
+        clear();
+        (*this->writer_)(*this);
+      }
 
-    // send buffer to screen
-    display();
+      // decrement auto-redraw
+      if (this->automatic_redraw_skip_frames_ > 0)
+      {
+        this->automatic_redraw_skip_frames_--;
+      }
+
+      // send buffer to screen
+      display();
+    }
+
+    update_cadence(this->base_frame_ != previous);
   }
 
   float SDA5708Component::get_setup_priority() const
@@ -64,21 +239,41 @@ namespace esphome::sda5708
   void SDA5708Component::clear()
   {
     std::fill(this->display_buffer_.begin(), this->display_buffer_.end(), ' ');
+    this->digit_font_banks_.fill(this->font_bank_);
+    this->static_digits_ = 0;
+    this->graph_ = nullptr;
+    this->graph_digits_ = 0;
   }
 
   void SDA5708Component::display()
   {
-    const auto &font = get_font();
+    render_buffer(this->base_frame_);
+    present();
+  }
+
+  void SDA5708Component::render_buffer(SDAPackedFrame &frame, const uint8_t digits) const
+  {
+    const auto &font = this->font_;
 
     for (uint8_t i = 0; i < this->display_buffer_.size(); i++)
     {
+      if (!(digits & (1 << i)) || (this->static_digits_ & (1 << i)))
+        continue;
+
       char c = this->display_buffer_[i];
 
-      if (const auto glyph_opt = font.get_glyph(c); glyph_opt.has_value())
-        write_glyph(i, glyph_opt.value());
+      if (const auto glyph_opt = font.get_glyph(c, this->digit_font_banks_[i]); glyph_opt.has_value())
+      {
+        frame.set_glyph(i, glyph_opt.value());
+      }
       else
+      {
         ESP_LOGW(TAG, "No glyph found for character '%c' (0x%02X)", c, static_cast<uint8_t>(c));
+        frame.set_glyph(i, {});
+      }
     }
+
+    frame.copy_digits(this->static_frame_, this->static_digits_ & digits);
   }
 #pragma endregion
 
@@ -92,6 +287,9 @@ namespace esphome::sda5708
     while (str[i] != '\0' && pos + i < this->display_buffer_.size())
     {
       this->display_buffer_[pos + i] = str[i];
+      this->digit_font_banks_[pos + i] = this->font_bank_;
+      this->static_digits_ &= ~(1 << (pos + i));
+      this->graph_digits_ &= ~(1 << (pos + i));
       i++;
     }
 
@@ -103,6 +301,129 @@ namespace esphome::sda5708
     return print(0, str);
   }
 
+  void SDA5708Component::set_digit_font_bank(const uint8_t digit, const SDAFontBank *bank)
+  {
+    if (digit >= this->digit_font_banks_.size())
+      return;
+
+    this->digit_font_banks_[digit] = bank;
+  }
+
+  char SDA5708Component::set_cached_glyph(const char *key, const SDAGlyph_t &glyph)
+  {
+    bool changed;
+    const char c = this->font_.get_glyph_cache().put(SDAGlyphCache::hash_key(key), glyph, changed);
+    if (!changed)
+      return c;
+
+#ifdef USE_SDA5708_PROPORTIONAL
+    // cached layouts may use the old glyph
+    this->proportional_cache_.clear();
+#endif
+
+    // redraw only the digits showing the slot, they are sent with the next frame
+    uint8_t digits = 0;
+    for (uint8_t i = 0; i < this->display_buffer_.size(); i++)
+    {
+      if (this->display_buffer_[i] == c)
+        digits |= (1 << i);
+    }
+
+    digits &= ~this->static_digits_;
+    if (digits != 0)
+    {
+      render_buffer(this->base_frame_, digits);
+      this->layers_dirty_ = true;
+    }
+
+    return c;
+  }
+
+  uint8_t SDA5708Component::print_cached_glyph(uint8_t pos, const char *key)
+  {
+    const char c = this->font_.get_glyph_cache().find(SDAGlyphCache::hash_key(key));
+    const char str[] = {c != '\0' ? c : ' ', '\0'};
+    return print(pos, str);
+  }
+
+  uint8_t SDA5708Component::print_static(uint8_t pos, const SDAStaticText &stored)
+  {
+    if (pos >= this->display_buffer_.size())
+      return pos;
+
+#ifdef USE_ESP8266
+    // static texts are in flash, which the ESP8266 can only read with aligned 32 bit accesses
+    SDAStaticText text;
+    const uint8_t *src = reinterpret_cast<const uint8_t *>(&stored);
+    uint8_t *dst = reinterpret_cast<uint8_t *>(&text);
+    for (size_t i = 0; i < sizeof(SDAStaticText); i++)
+      dst[i] = progmem_read_byte(src + i);
+#else
+    const SDAStaticText &text = stored;
+#endif
+
+    const uint8_t end = std::min<uint8_t>(pos + text.length, this->display_buffer_.size());
+    const uint8_t digits = ((1 << end) - 1) & ~((1 << pos) - 1);
+
+    if (pos == 0)
+    {
+      this->static_frame_.copy_digits(text.frame, digits);
+    }
+    else
+    {
+      SDAPackedFrame shifted = text.frame;
+      shifted.shift_right(pos * SDAPackedFrame::DIGIT_COLUMNS);
+      this->static_frame_.copy_digits(shifted, digits);
+    }
+    this->static_digits_ |= digits;
+    this->graph_digits_ &= ~digits;
+
+    return end;
+  }
+
+  uint8_t SDA5708Component::print_static(const SDAStaticText &text)
+  {
+    return print_static(0, text);
+  }
+
+#ifdef USE_SDA5708_PROPORTIONAL
+  uint8_t SDA5708Component::print_proportional(uint8_t pos, const char *str)
+  {
+    if (pos >= this->display_buffer_.size())
+      return pos;
+
+    // the same text laid out for less columns is a different layout
+    const uint8_t max_columns = (this->display_buffer_.size() - pos) * SDAPackedFrame::DIGIT_COLUMNS;
+    const uint32_t key = SDAGlyphCache::hash_key(str) ^ max_columns;
+
+    const SDAProportionalText *text = this->proportional_cache_.find(key, this->font_bank_);
+    if (text == nullptr)
+    {
+      SDAProportionalText &entry = this->proportional_cache_.put(key, this->font_bank_);
+      this->font_.layout_proportional(str, this->font_bank_, max_columns, entry);
+      text = &entry;
+    }
+
+    const uint8_t end = pos + (text->columns + SDAPackedFrame::DIGIT_COLUMNS - 1) / SDAPackedFrame::DIGIT_COLUMNS;
+    const uint8_t digits = ((1 << end) - 1) & ~((1 << pos) - 1);
+
+    // shown like a static text
+    SDAPackedFrame shifted = text->frame;
+    shifted.shift_right(pos * SDAPackedFrame::DIGIT_COLUMNS);
+    this->static_frame_.copy_digits(shifted, digits);
+    this->static_digits_ |= digits;
+    this->graph_digits_ &= ~digits;
+
+    return end;
+  }
+
+  uint8_t SDA5708Component::print_proportional(const char *str)
+  {
+    return print_proportional(0, str);
+  }
+#endif
+
+#ifdef USE_SDA5708_PRINTF
   uint8_t SDA5708Component::printf(uint8_t pos, const char *format, ...)
   {
     char buffer[64];
@@ -130,7 +451,9 @@ namespace esphome::sda5708
 
     return print(0, buffer);
   }
+#endif
 
+#ifdef USE_SDA5708_STRFTIME
   uint8_t SDA5708Component::strftime(uint8_t pos, const char *format, ESPTime time)
   {
     char buffer[64];
@@ -146,6 +469,7 @@ namespace esphome::sda5708
   {
     return strftime(0, format, time);
   }
+#endif
 
   void SDA5708Component::pause_automatic_redraw(const int frames)
   {
@@ -158,6 +482,498 @@ namespace esphome::sda5708
   }
 #pragma endregion
 
+#pragma region Layer & Attribute API
+  void SDA5708Component::set_overlay_glyph(const uint8_t digit, const SDAGlyph_t &glyph)
+  {
+    if (digit >= SDAPackedFrame::DIGITS)
+      return;
+
+    this->overlay_frame_.set_glyph(digit, glyph);
+    this->layers_dirty_ = true;
+  }
+
+  void SDA5708Component::set_overlay_char(const uint8_t digit, const char c)
+  {
+    if (const auto glyph_opt = this->font_.get_glyph(c); glyph_opt.has_value())
+      set_overlay_glyph(digit, glyph_opt.value());
+    else
+      ESP_LOGW(TAG, "No glyph found for character '%c' (0x%02X)", c, static_cast<uint8_t>(c));
+  }
+
+  void SDA5708Component::clear_overlay()
+  {
+    this->overlay_frame_.clear();
+    this->layers_dirty_ = true;
+  }
+
+  void SDA5708Component::set_digit_attributes(const uint8_t digit, const SDADigitAttributes &attributes)
+  {
+    if (digit >= this->digit_attributes_.size())
+      return;
+
+    auto &attr = this->digit_attributes_[digit];
+    attr = attributes;
+
+    // blink phases are counted in half periods, so the period needs to be at least 2ms
+    if (attr.blink_period == 1)
+      attr.blink_period = 2;
+
+    const uint8_t bit = (1 << digit);
+    this->blink_digits_ = attr.blink_period != 0 ? (this->blink_digits_ | bit) : (this->blink_digits_ & ~bit);
+    this->invert_digits_ = attr.invert ? (this->invert_digits_ | bit) : (this->invert_digits_ & ~bit);
+    this->underline_digits_ = attr.underline ? (this->underline_digits_ | bit) : (this->underline_digits_ & ~bit);
+
+    this->layers_dirty_ = true;
+  }
+
+  void SDA5708Component::set_digit_blink(const uint8_t digit, const uint16_t period)
+  {
+    if (digit >= this->digit_attributes_.size())
+      return;
+
+    auto attributes = this->digit_attributes_[digit];
+    attributes.blink_period = period;
+    set_digit_attributes(digit, attributes);
+  }
+
+  void SDA5708Component::set_digit_invert(const uint8_t digit, const bool invert)
+  {
+    if (digit >= this->digit_attributes_.size())
+      return;
+
+    auto attributes = this->digit_attributes_[digit];
+    attributes.invert = invert;
+    set_digit_attributes(digit, attributes);
+  }
+
+  void SDA5708Component::set_digit_underline(const uint8_t digit, const bool underline)
+  {
+    if (digit >= this->digit_attributes_.size())
+      return;
+
+    auto attributes = this->digit_attributes_[digit];
+    attributes.underline = underline;
+    set_digit_attributes(digit, attributes);
+  }
+
+  void SDA5708Component::clear_digit_attributes()
+  {
+    this->digit_attributes_ = {};
+    this->blink_digits_ = 0;
+    this->invert_digits_ = 0;
+    this->underline_digits_ = 0;
+    this->layers_dirty_ = true;
+  }
+
+  uint8_t SDA5708Component::get_blink_visible(const uint32_t now) const
+  {
+    uint8_t visible = 0xFF;
+    for (uint8_t digit = 0; digit < this->digit_attributes_.size(); digit++)
+    {
+      if ((this->blink_digits_ & (1 << digit)) == 0)
+        continue;
+
+      // odd half periods are the off phase
+      const uint32_t half_period = this->digit_attributes_[digit].blink_period / 2;
+      if ((now / half_period) & 1)
+        visible &= ~(1 << digit);
+    }
+
+    return visible;
+  }
+
+  void SDA5708Component::present()
+  {
+    // screen is blanked while idle, content is sent again on wake-up
+    if (this->idle_blanked_)
+      return;
+
+    SDAPackedFrame frame = this->base_frame_;
+    frame.compose(this->overlay_frame_);
+
+    if (this->underline_digits_ != 0)
+    {
+      const uint8_t row = SDAPackedFrame::ROWS - 1;
+      frame.set_row(row, frame.get_row(row) | SDAPackedFrame::digits_mask(this->underline_digits_));
+    }
+
+    frame.invert_digits(this->invert_digits_);
+    frame.mask_digits(this->blink_visible_);
+
+    this->layers_dirty_ = false;
+    write_frame(frame);
+  }
+#pragma endregion
+
+#pragma region Graph API
+  void SDA5708Component::graph(SDAGraph *graph)
+  {
+    if (graph == nullptr)
+      return;
+
+    // the graph is drawn like static text, so the regular rendering keeps it
+    this->static_frame_ = graph->get_frame();
+    this->static_digits_ = 0xFF;
+    this->graph_ = graph;
+    this->graph_digits_ = 0xFF;
+    graph->clear_dirty();
+  }
+
+#ifdef USE_SENSOR
+  void SDA5708Component::add_graph_sensor(SDAGraph *graph, sensor::Sensor *sensor)
+  {
+    sensor->add_on_state_callback([graph](float state) { graph->push(state); });
+  }
+#endif
+
+  void SDA5708Component::apply_graph()
+  {
+    const SDAPackedFrame &frame = this->graph_->get_frame();
+    this->graph_->clear_dirty();
+
+    this->static_frame_.copy_digits(frame, this->graph_digits_);
+    this->base_frame_.copy_digits(frame, this->graph_digits_);
+
+    // sent with the layers below, only changed digits go to the screen
+    this->layers_dirty_ = true;
+
+    // a live graph is activity, it must not go idle while values arrive
+    if (this->graph_digits_ != 0)
+      wake();
+  }
+#pragma endregion
+
+#pragma region Layout API
+  void SDA5708Component::set_layout(SDALayout *layout)
+  {
+    this->layout_ = layout;
+    clear();
+  }
+
+  void SDA5708Component::apply_layout(const bool with_time)
+  {
+    const uint8_t digits = this->layout_->refresh(this->display_buffer_.data(), with_time);
+    if (digits == 0)
+      return;
+
+    // changed digits are printed like by print()
+    for (uint8_t i = 0; i < this->digit_font_banks_.size(); i++)
+    {
+      if (digits & (1 << i))
+        this->digit_font_banks_[i] = this->font_bank_;
+    }
+    this->static_digits_ &= ~digits;
+    this->graph_digits_ &= ~digits;
+
+    render_buffer(this->base_frame_, digits);
+    this->layers_dirty_ = true;
+
+    // fields changed outside of update(), where update_cadence() would not notice them
+    wake();
+  }
+#pragma endregion
+
+#pragma region Page API
+  void SDA5708Component::add_page(SDA5708Page *page)
+  {
+    this->pages_.push_back(page);
+    if (this->page_ == nullptr)
+      this->page_ = page;
+  }
+
+  void SDA5708Component::show_page(SDA5708Page *page)
+  {
+    if (page == nullptr || page == this->page_)
+      return;
+
+    this->page_ = page;
+    wake();
+
+    // page is shown on the next update if something else owns the screen
+    if (this->animation_ != nullptr || this->sequence_ != nullptr || this->message_active_ || this->automatic_redraw_skip_frames_ != 0)
+      return;
+
+    if (!page->has_cache())
+    {
+      render_active_page();
+      return;
+    }
+
+    // show the cached frame right away, and refresh it in the background
+    this->base_frame_ = page->get_cache();
+    present();
+    this->defer([this, page]() {
+      // skip if the screen changed owner in the meantime
+      if (this->page_ != page || this->animation_ != nullptr || this->sequence_ != nullptr || this->message_active_ ||
+          this->automatic_redraw_skip_frames_ != 0)
+        return;
+
+      render_active_page();
+    });
+  }
+
+  void SDA5708Component::show_next_page()
+  {
+    show_page_offset(1);
+  }
+
+  void SDA5708Component::show_previous_page()
+  {
+    show_page_offset(-1);
+  }
+
+  void SDA5708Component::show_page_offset(const int offset)
+  {
+    const int count = this->pages_.size();
+    if (count == 0)
+      return;
+
+    int index = 0;
+    for (int i = 0; i < count; i++)
+    {
+      if (this->pages_[i] == this->page_)
+        index = i;
+    }
+
+    index = ((index + offset) % count + count) % count;
+    show_page(this->pages_[index]);
+  }
+
+  void SDA5708Component::render_active_page()
+  {
+    clear();
+    this->page_->render(*this);
+
+    render_buffer(this->base_frame_);
+    this->page_->set_cache(this->base_frame_);
+    present();
+  }
+#pragma endregion
+
+#pragma region Animation API
+  void SDA5708Component::play_animation(const SDAAnimation *animation, const bool loop)
+  {
+    if (animation == nullptr || animation->get_frame_count() == 0)
+    {
+      stop_animation();
+      return;
+    }
+
+    wake();
+
+    this->animation_ = animation;
+    this->animation_cursor_ = animation->get_data();
+    this->animation_frame_ = 0;
+    this->animation_screen_.clear();
+    this->animation_loop_ = loop;
+
+    // show the first frame right away
+    this->animation_frame_start_ = millis();
+    write_next_animation_frame();
+  }
+
+  void SDA5708Component::stop_animation()
+  {
+    this->animation_ = nullptr;
+    this->animation_cursor_ = nullptr;
+
+    // bring back a message that was hidden by the animation
+    if (this->message_active_)
+      render_message();
+  }
+
+  void SDA5708Component::write_next_animation_frame()
+  {
+    if (this->animation_frame_ >= this->animation_->get_frame_count())
+    {
+      if (!this->animation_loop_)
+      {
+        stop_animation();
+        return;
+      }
+
+      // first frame is always a full frame, even when delta-encoded
+      this->animation_cursor_ = this->animation_->get_data();
+      this->animation_frame_ = 0;
+    }
+
+    const uint8_t *data = this->animation_cursor_;
+
+    uint8_t changed_digits = 0xFF;
+    if (this->animation_->is_delta_encoded())
+      changed_digits = progmem_read_byte(data++);
+
+    for (uint8_t digit = 0; digit < 8; digit++)
+    {
+      if ((changed_digits & (1 << digit)) == 0)
+        continue;
+
+      SDAGlyph_t glyph;
+      for (auto &row : glyph)
+        row = progmem_read_byte(data++);
+
+      this->animation_screen_.set_glyph(digit, glyph);
+    }
+
+    write_frame(this->animation_screen_);
+    this->animation_cursor_ = data;
+    this->animation_frame_++;
+  }
+#pragma endregion
+
+#pragma region Message API
+  bool SDA5708Component::show_message(const char *text, const uint8_t priority, const uint32_t duration, const bool scroll, const uint32_t expiry)
+  {
+    const uint32_t now = millis();
+
+    SDAMessage message{};
+    strncpy(message.text, text, MESSAGE_MAX_LENGTH);
+    message.priority = priority;
+    message.scroll = scroll;
+    message.duration = duration;
+    message.expires = expiry != 0;
+    message.expires_at = now + expiry;
+
+    wake();
+
+    if (!this->message_active_)
+    {
+      this->message_saved_buffer_ = this->display_buffer_;
+      this->message_saved_static_frame_ = this->static_frame_;
+      this->message_saved_static_digits_ = this->static_digits_;
+      this->message_saved_font_banks_ = this->digit_font_banks_;
+      activate_message(message, now);
+      return true;
+    }
+
+    if (priority > this->active_message_.priority)
+    {
+      // re-queue the preempted message with its remaining duration
+      SDAMessage preempted = this->active_message_;
+      const uint32_t elapsed = now - this->message_start_;
+      if (preempted.duration == 0 || elapsed < preempted.duration)
+      {
+        if (preempted.duration != 0)
+          preempted.duration -= elapsed;
+
+        if (!this->message_queue_.push_front(preempted))
+          ESP_LOGW(TAG, "Message queue full, dropping preempted message");
+      }
+
+      activate_message(message, now);
+      return true;
+    }
+
+    if (!this->message_queue_.push(message))
+    {
+      ESP_LOGW(TAG, "Message queue full, dropping message");
+      return false;
+    }
+
+    return true;
+  }
+
+  void SDA5708Component::clear_messages()
+  {
+    this->message_queue_.clear();
+    if (!this->message_active_)
+      return;
+
+    this->message_active_ = false;
+    this->display_buffer_ = this->message_saved_buffer_;
+    this->static_frame_ = this->message_saved_static_frame_;
+    this->static_digits_ = this->message_saved_static_digits_;
+    this->digit_font_banks_ = this->message_saved_font_banks_;
+
+    // a layout only renders the digits that change, so the rest has to be restored here
+    if (this->layout_ != nullptr)
+      render_buffer(this->base_frame_);
+
+    update();
+  }
+
+  void SDA5708Component::process_messages(const uint32_t now)
+  {
+    if (this->active_message_.duration != 0 && now - this->message_start_ >= this->active_message_.duration)
+    {
+      finish_message(now);
+      return;
+    }
+
+    if (this->active_message_.scroll &&
+        this->message_length_ > this->display_buffer_.size() &&
+        now - this->message_scroll_last_ >= this->message_scroll_interval_)
+    {
+      this->message_scroll_last_ = now;
+      this->message_scroll_pos_++;
+      render_message();
+    }
+  }
+
+  void SDA5708Component::activate_message(const SDAMessage &message, const uint32_t now)
+  {
+    this->active_message_ = message;
+    this->message_active_ = true;
+    this->message_length_ = strlen(message.text);
+    this->message_start_ = now;
+    this->message_scroll_pos_ = 0;
+    this->message_scroll_last_ = now;
+
+    render_message();
+  }
+
+  void SDA5708Component::finish_message(const uint32_t now)
+  {
+    SDAMessage next;
+    if (this->message_queue_.pop(now, next))
+    {
+      activate_message(next, now);
+      return;
+    }
+
+    // no more messages, return to normal content right away
+    this->message_active_ = false;
+    this->display_buffer_ = this->message_saved_buffer_;
+    this->static_frame_ = this->message_saved_static_frame_;
+    this->static_digits_ = this->message_saved_static_digits_;
+    this->digit_font_banks_ = this->message_saved_font_banks_;
+
+    // a layout only renders the digits that change, so the rest has to be restored here
+    if (this->layout_ != nullptr)
+      render_buffer(this->base_frame_);
+
+    update();
+  }
+
+  void SDA5708Component::render_message()
+  {
+    const char *text = this->active_message_.text;
+    const size_t screen_size = this->display_buffer_.size();
+
+    if (!this->active_message_.scroll || this->message_length_ <= screen_size)
+    {
+      clear();
+      print(text);
+    }
+    else
+    {
+      this->static_digits_ = 0;
+      this->digit_font_banks_.fill(this->font_bank_);
+
+      // scroll through the text, followed by a full screen of blanks
+      const size_t period = this->message_length_ + screen_size;
+      for (size_t i = 0; i < screen_size; i++)
+      {
+        const size_t idx = (this->message_scroll_pos_ + i) % period;
+        this->display_buffer_[i] = idx < this->message_length_ ? text[idx] : ' ';
+      }
+    }
+
+    if (this->animation_ == nullptr && this->sequence_ == nullptr)
+      display();
+  }
+#pragma endregion
+
 #pragma region High-Level Screen API
   void SDA5708Component::screen_clear()
   {
@@ -167,13 +983,19 @@ namespace esphome::sda5708
     // set CLR back to normal operation after clearing
     this->control_register_.m_bCLR = false;
     write_control_register(this->control_register_);
+
+    // screen contents are gone, next frame has to be sent in full
+    this->screen_frame_valid_ = 0;
+    if (this->power_estimation_)
+      set_lit_pixels(0);
   }
 
   void SDA5708Component::set_brightness(const uint8_t brightness)
   {
-    // invert brightness level for control register (0 -> 7, 7 -> 0)
-    this->control_register_.m_nBR = 7 - (brightness & 0b111);
-    write_control_register(this->control_register_);
+    // manual brightness changes override a running fade, and become the level to return to after night mode or idle
+    this->fade_active_ = false;
+    this->manual_brightness_ = brightness & 0b111;
+    write_brightness(brightness);
   }
 
   uint8_t SDA5708Component::get_brightness() const
@@ -193,16 +1015,42 @@ namespace esphome::sda5708
     return this->control_register_.m_bIP;
   }
 
-  void SDA5708Component::write_glyph(const uint8_t digit, const SDAGlyph_t &glyph) const
+  void SDA5708Component::write_glyph(const uint8_t digit, const SDAGlyph_t &glyph)
   {
-    select_digit(digit);
-    write_digit_data(glyph);
+    if (digit >= SDAPackedFrame::DIGITS)
+      return;
+
+    SDAPackedFrame frame = this->screen_frame_;
+    frame.set_glyph(digit, glyph);
+    write_digits(frame, 1 << digit);
+  }
+
+  void SDA5708Component::write_frame(const SDAPackedFrame &frame)
+  {
+#ifdef USE_SDA5708_SYNC
+    // all content is shown at the next presentation time
+    if (this->sync_time_ != nullptr && !this->sync_direct_)
+    {
+      this->sync_frame_ = frame;
+      this->sync_pending_ = true;
+      return;
+    }
+#endif
+
+    const uint8_t digits = frame.diff(this->screen_frame_) | static_cast<uint8_t>(~this->screen_frame_valid_);
+    if (digits != 0)
+      write_digits(frame, digits);
   }
 #pragma endregion
 
 #pragma region Low-Level API
   void SDA5708Component::screen_reset()
   {
+#ifdef USE_SDA5708_ISR_TRANSMIT
+    // bytes still queued would be sent after the reset
+    wait_shift_idle();
+#endif
+
     // #RESET LOW to reset
     this->reset_pin_->digital_write(false);
     screen_delay();
@@ -211,16 +1059,30 @@ namespace esphome::sda5708
     this->reset_pin_->digital_write(true);
     screen_delay();
 
-    // reset internal control register mirror to default values
+#ifdef USE_SDA5708_BUS_TRACE
+    this->bus_trace_.record_reset(micros());
+#endif
+#ifdef USE_SDA5708_VIRTUAL_SCREEN
+    this->virtual_screen_.reset();
+#endif
+
+    // reset internal control register and screen mirrors to default values
     control_register_ = SDAControlRegister();
+    screen_frame_valid_ = 0;
+    lit_pixels_ = 0;
 
     // apply control register settings set by codegen after reset
     set_peak_current(init_peak_current_);
     set_brightness(init_brightness_);
   }
 
-  void SDA5708Component::write_control_register(const SDAControlRegister &data) const
+  void SDA5708Component::write_control_register(const SDAControlRegister &requested) const
   {
+    SDAControlRegister data = requested;
+    if (this->max_current_ > 0.0f)
+      limit_current(data);
+    this->control_written_ = data;
+
     uint8_t cr = 0b11000000;            // select control register with D7=1, D6=1 and D4=0
     cr |= (data.m_bCLR ? 0 : (1 << 5)); // CLR bit (active low) on D5
     cr |= (data.m_bIP ? (1 << 4) : 0);  // IP bit on D4
@@ -229,12 +1091,52 @@ namespace esphome::sda5708
     write_byte(cr);
   }
 
-  void SDA5708Component::select_digit(const uint8_t _digit) const
+  void SDA5708Component::write_digits(const SDAPackedFrame &frame, const uint8_t digits)
   {
-    auto digit = _digit;
+    // rotating the whole frame once is cheaper than rotating each row that is sent
+#ifdef USE_SDA5708_ROTATION
+    SDAPackedFrame screen = frame;
     if (this->rotate_screen_)
-      digit = 7 - digit;
+      screen.mirror();
+#else
+    const SDAPackedFrame &screen = frame;
+#endif
+
+    // more lit pixels may need a lower brightness before they are sent, fewer allow a higher one afterwards
+    uint16_t lit_pixels = this->lit_pixels_;
+    if (this->power_estimation_)
+    {
+      SDAPackedFrame next = this->screen_frame_;
+      next.copy_digits(frame, digits);
+      lit_pixels = next.popcount();
+      if (lit_pixels > this->lit_pixels_)
+        set_lit_pixels(lit_pixels);
+    }
+
+    for (uint8_t digit = 0; digit < SDAPackedFrame::DIGITS; digit++)
+    {
+      if ((digits & (1 << digit)) == 0)
+        continue;
+
+#ifdef USE_SDA5708_ROTATION
+      const uint8_t physical_digit = this->rotate_screen_ ? (SDAPackedFrame::DIGITS - 1 - digit) : digit;
+#else
+      const uint8_t physical_digit = digit;
+#endif
+      select_digit(physical_digit);
+      write_digit_data(screen, physical_digit);
+    }
 
+    this->screen_frame_.copy_digits(frame, digits);
+    this->screen_frame_valid_ |= digits;
+    this->mirror_pending_ = true;
+
+    if (lit_pixels < this->lit_pixels_)
+      set_lit_pixels(lit_pixels);
+  }
+
+  void SDA5708Component::select_digit(const uint8_t digit) const
+  {
     if (digit > 7)
       return;
 
@@ -244,28 +1146,12 @@ namespace esphome::sda5708
     write_byte(cs);
   }
 
-  void SDA5708Component::write_digit_data(const SDAGlyph_t &data) const
+  void SDA5708Component::write_digit_data(const SDAPackedFrame &frame, const uint8_t digit) const
   {
-    for (int i = 0; i < 7; i++)
+    for (uint8_t row = 0; row < SDAPackedFrame::ROWS; row++)
     {
-      int j = i;
-      if (this->rotate_screen_)
-        j = 6 - j;
-
-      uint8_t cols = data[j];
-      if (this->rotate_screen_)
-      {
-        uint8_t rcols = 0;
-        for (int bit = 0; bit < 5; bit++)
-        {
-          rcols |= ((cols >> bit) & 0x01) << (4 - bit);
-        }
-
-        cols = rcols;
-      }
-
-      uint8_t cd = 0b00000000; // column data register with D7=0, D6=0, D5=0
-      cd |= (cols & 0b11111);  // remaining 5 bits for column data
+      uint8_t cd = 0b00000000;               // column data register with D7=0, D6=0, D5=0
+      cd |= frame.get_digit_row(digit, row); // remaining 5 bits for column data
 
       write_byte(cd);
     }
@@ -273,6 +1159,32 @@ namespace esphome::sda5708
 
   void SDA5708Component::write_byte(const uint8_t data) const
   {
+#ifdef USE_SDA5708_BUS_TRACE
+    this->bus_trace_.record(micros(), data);
+#endif
+
+#ifdef USE_SDA5708_VIRTUAL_SCREEN
+    // no screen attached, the emulation takes the byte without any bus timing
+    this->virtual_screen_.write(data);
+    return;
+#endif
+
+#ifdef USE_SDA5708_ISR_TRANSMIT
+    if (this->shift_ready_)
+    {
+      queue_byte(data);
+      return;
+    }
+#endif
+
+#ifdef USE_SDA5708_FAST_GPIO
+    if (this->fast_gpio_)
+    {
+      write_byte_fast(data);
+      return;
+    }
+#endif
+
     // #LOAD LOW to start transfer
     this->load_pin_->digital_write(false);
 
@@ -295,6 +1207,50 @@ namespace esphome::sda5708
     screen_delay();
   }
 
+#ifdef USE_SDA5708_FAST_GPIO
+  void SDA5708Component::setup_fast_gpio()
+  {
+    // the reset pin is not used on the fast path, but pins on expanders should not mix with direct writes
+    SDAFastPin reset;
+    if (!this->fast_data_pin_.resolve(this->data_pin_) ||
+        !this->fast_clock_pin_.resolve(this->clock_pin_) ||
+        !this->fast_load_pin_.resolve(this->load_pin_) ||
+        !reset.resolve(this->reset_pin_))
+    {
+      ESP_LOGD(TAG, "Not all pins are internal GPIOs, using generic GPIO");
+      return;
+    }
+
+    // 2x margin over the ~200ns minimum, the cycle counter is exact unlike `delayMicroseconds()`
+    static constexpr uint32_t FAST_DELAY_NS = 400;
+    this->fast_delay_cycles_ = static_cast<uint64_t>(arch_get_cpu_freq_hz()) * FAST_DELAY_NS / 1000000000ULL;
+    this->fast_gpio_ = true;
+  }
+
+  void SDA5708Component::write_byte_fast(const uint8_t data) const
+  {
+    // #LOAD LOW to start transfer
+    this->fast_load_pin_.write(false);
+
+    // shift out 8 bits, LSB first. data is taken over on the rising clock edge,
+    // so the only delays needed are the data setup time and the clock high time
+    for (uint8_t i = 0; i < 8; i++)
+    {
+      this->fast_data_pin_.write((data >> i) & 0x01);
+      fast_delay();
+
+      this->fast_clock_pin_.write(true);
+      fast_delay();
+      this->fast_clock_pin_.write(false);
+    }
+
+    // #LOAD HIGH to end transfer, then give the screen time to process the byte
+    fast_delay();
+    this->fast_load_pin_.write(true);
+    fast_delay();
+  }
+#endif
+
   void SDA5708Component::screen_delay() const
   {
     // the screen requires a short delay for data processing.
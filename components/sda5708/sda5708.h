@@ -1,21 +1,77 @@
 #pragma once
 #include <cstdint>
 #include <array>
-#include <map>
 #include <optional>
+#include <string>
+#include <vector>
 
+#include "esphome/core/defines.h"
 #include "esphome/core/hal.h"
 #include "esphome/core/component.h"
+#include "esphome/core/helpers.h"
 #include "esphome/core/time.h"
 
 #include "esphome/components/display/display.h"
+#ifdef USE_SDA5708_CUSTOM_GLYPHS
+#include <map>
+#endif
+#ifdef USE_SENSOR
+#include "esphome/components/sensor/sensor.h"
+#endif
+#ifdef USE_TIME
+#include "esphome/components/time/real_time_clock.h"
+#endif
+#ifdef USE_TEXT_SENSOR
+#include "esphome/components/text_sensor/text_sensor.h"
+#endif
+#ifdef USE_SDA5708_STREAM_UART
+#include "esphome/components/uart/uart.h"
+#endif
+#ifdef USE_SDA5708_STREAM_SOCKET
+#include <memory>
+#include "esphome/components/socket/socket.h"
+#endif
+
+#include "sda5708_animation.h"
+#include "sda5708_fast_gpio.h"
+#include "sda5708_font.h"
+#include "sda5708_frame.h"
+#include "sda5708_glyph_cache.h"
+#include "sda5708_graph.h"
+#include "sda5708_layout.h"
+#include "sda5708_message.h"
+#include "sda5708_sequence.h"
+#ifdef USE_SDA5708_ISR_TRANSMIT
+#include "sda5708_shift.h"
+#ifdef USE_ESP32
+#include "driver/gptimer.h"
+#endif
+#endif
+#ifdef USE_SDA5708_PROPORTIONAL
+#include "sda5708_proportional.h"
+#endif
+#include "sda5708_stream.h"
+#ifdef USE_SDA5708_BUS_TRACE
+#include "sda5708_trace.h"
+#endif
+#ifdef USE_SDA5708_VIRTUAL_SCREEN
+#include "sda5708_virtual.h"
+#endif
 
 namespace esphome::sda5708
 {
-  /// Glyph data for a single 5x7 character on the screen.
-  /// Each byte represents one row (of the 7 rows) of the character,
-  /// with the 5 least significant bits representing the 5 columns (1: lit, 0: unlit).
-  typedef std::array<uint8_t, 7> SDAGlyph_t;
+  /// Display attributes of a single digit, applied on top of the rendered content.
+  struct SDADigitAttributes
+  {
+    /// Blink period in milliseconds (on and off phase combined). 0 disables blinking.
+    uint16_t blink_period = 0;
+
+    /// Invert all pixels of the digit.
+    bool invert = false;
+
+    /// Light up the bottom row of the digit.
+    bool underline = false;
+  };
 
   /// Font definition for SDA5708.
   class SDA5708Font
@@ -26,25 +82,91 @@ namespace esphome::sda5708
     /// @return The SDAGlyph_t to write the glyph data to.
     std::optional<const SDAGlyph_t> get_glyph(const char c) const;
 
+    /// Get the glyph data for a given character, looking it up in the given font bank first.
+    /// @param c The char to get the glyph data for.
+    /// @param bank The font bank to use, or nullptr for the regular font.
+    std::optional<const SDAGlyph_t> get_glyph(const char c, const SDAFontBank *bank) const;
+
+#ifdef USE_SDA5708_CUSTOM_GLYPHS
     /// Set a custom glyph for a given character. This may overwrite existing default glyphs.
     /// @param c The char to set the glyph data for.
     /// @param glyph The SDAGlyph_t containing the glyph data to set.
     void set_glyph(const char c, const SDAGlyph_t &glyph);
+#endif
+
+    /// Get the cache of glyphs set at runtime, bound to private-use characters.
+    SDAGlyphCache &get_glyph_cache()
+    {
+      return this->glyph_cache_;
+    }
+
+#ifdef USE_SDA5708_PROPORTIONAL
+    /// Lay out a text with proportional glyph widths, packing the glyphs across the pixel columns of the screen.
+    /// Glyphs that do not fit entirely into `max_columns` are left out.
+    void layout_proportional(const char *text, const SDAFontBank *bank, const uint8_t max_columns, SDAProportionalText &result) const;
+#endif
 
   private:
-    static const std::map<char, SDAGlyph_t> default_glyphs_;
+#ifdef USE_SDA5708_PROPORTIONAL
+    /// Is the glyph of the character taken from the built-in font (and measured at compile time)?
+    bool is_default_glyph(const char c, const SDAFontBank *bank) const;
+#endif
+
+#ifdef USE_SDA5708_CUSTOM_GLYPHS
     std::map<char, SDAGlyph_t> user_glyphs_;
+#endif
+    SDAGlyphCache glyph_cache_;
   };
 
   class SDA5708Component;
   using sda5708_writer_t = display::DisplayWriter<SDA5708Component>;
 
+  /// A page of content, rendered by its own writer lambda.
+  /// The last rendered frame of each page is cached, so switching to a page can show it right away.
+  class SDA5708Page
+  {
+  public:
+    SDA5708Page(sda5708_writer_t &&writer) : writer_(std::move(writer)) {}
+
+    /// Render the page using its writer lambda.
+    void render(SDA5708Component &it)
+    {
+      if (this->writer_.has_value())
+        (*this->writer_)(it);
+    }
+
+    /// Get the cached frame of this page. Only valid if `has_cache()` is true.
+    const SDAPackedFrame &get_cache() const
+    {
+      return this->cache_;
+    }
+
+    /// Was this page rendered at least once?
+    bool has_cache() const
+    {
+      return this->has_cache_;
+    }
+
+    /// Update the cached frame of this page.
+    void set_cache(const SDAPackedFrame &frame)
+    {
+      this->cache_ = frame;
+      this->has_cache_ = true;
+    }
+
+  private:
+    sda5708_writer_t writer_;
+    SDAPackedFrame cache_{};
+    bool has_cache_ = false;
+  };
+
   /// ESPHome component for controlling a
   /// Siemens SDA5708-24 8 character 5x7 dot matrix LED display.
   class SDA5708Component : public PollingComponent
   {
   public:
     void setup() override;
+    void loop() override;
     void dump_config() override;
     void update() override;
     float get_setup_priority() const override;
@@ -65,6 +187,80 @@ namespace esphome::sda5708
     std::array<char, 8> display_buffer_{};
     SDA5708Font font_;
 
+    /// Font bank used by `print()`, and the bank each digit was printed with.
+    const SDAFontBank *font_bank_ = nullptr;
+    std::array<const SDAFontBank *, 8> digit_font_banks_{};
+
+    /// Glyphs printed via `print_static()`, used instead of the display buffer for the digits in `static_digits_`.
+    SDAPackedFrame static_frame_{};
+    uint8_t static_digits_ = 0;
+
+#ifdef USE_SDA5708_PROPORTIONAL
+    /// Layouts of recently printed proportional texts.
+    SDAProportionalCache proportional_cache_;
+#endif
+
+    /// Render the display buffer into glyph data.
+    /// @param frame The frame to write the glyph data to.
+    /// @param digits Bitmask of digits to render (bit 0: digit 0).
+    void render_buffer(SDAPackedFrame &frame, const uint8_t digits = 0xFF) const;
+
+  public: // Layer & Attribute API
+    /// Set the overlay glyph of a digit. The overlay is OR-ed on top of the rendered content.
+    /// @param digit The digit to set the overlay for (0-7, 0 is the leftmost digit)
+    /// @param glyph The overlay glyph data. All zeros disables the overlay.
+    void set_overlay_glyph(const uint8_t digit, const SDAGlyph_t &glyph);
+
+    /// Set the overlay of a digit to the glyph of the given character.
+    void set_overlay_char(const uint8_t digit, const char c);
+
+    /// Remove the overlay of all digits.
+    void clear_overlay();
+
+    /// Set the display attributes of a digit. Attributes are applied by the component itself,
+    /// so blinking does not require the writer lambda to run. Only affected digits are sent to the screen.
+    /// @param digit The digit to set the attributes for (0-7, 0 is the leftmost digit)
+    /// @param attributes The attributes to set.
+    void set_digit_attributes(const uint8_t digit, const SDADigitAttributes &attributes);
+
+    /// Make a digit blink with the given period (on and off phase combined), in milliseconds. 0 disables blinking.
+    void set_digit_blink(const uint8_t digit, const uint16_t period);
+
+    /// Invert all pixels of a digit.
+    void set_digit_invert(const uint8_t digit, const bool invert);
+
+    /// Light up the bottom row of a digit.
+    void set_digit_underline(const uint8_t digit, const bool underline);
+
+    /// Reset the attributes of all digits.
+    void clear_digit_attributes();
+
+  private:
+    /// Rendered content of the base (text) layer.
+    SDAPackedFrame base_frame_{};
+
+    /// Overlay layer, OR-ed on top of the base layer.
+    SDAPackedFrame overlay_frame_{};
+
+    std::array<SDADigitAttributes, 8> digit_attributes_{};
+
+    /// Bitmasks of digits with blinking, inverting and underline enabled (bit 0: digit 0).
+    uint8_t blink_digits_ = 0;
+    uint8_t invert_digits_ = 0;
+    uint8_t underline_digits_ = 0;
+
+    /// Bitmask of blinking digits currently in their on phase (bit 0: digit 0).
+    uint8_t blink_visible_ = 0xFF;
+
+    /// Overlay, attributes or base layer changed since the last time the screen was updated.
+    bool layers_dirty_ = false;
+
+    /// Get the bitmask of digits that are visible at the given time, considering blinking.
+    uint8_t get_blink_visible(const uint32_t now) const;
+
+    /// Compose the layers and attributes into a frame, and send changed digits to the screen.
+    void present();
+
     /// Remaining frames to skip auto-redraw for.
     /// if >= 0, skip auto-redraw and decrement this counter.
     /// if -1, auto-redraw is disabled indefinitely until re-enabled.
@@ -72,21 +268,65 @@ namespace esphome::sda5708
     int automatic_redraw_skip_frames_ = 0;
 
   public: // Print & Writer API
+#ifdef USE_SDA5708_PRINTF
     /// Evaluate the printf-format and print the result at the given position.
     uint8_t printf(uint8_t pos, const char *format, ...) __attribute__((format(printf, 3, 4)));
     /// Evaluate the printf-format and print the result at position 0.
     uint8_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+#endif
 
     /// Print `str` at the given position.
     uint8_t print(uint8_t pos, const char *str);
     /// Print `str` at position 0.
     uint8_t print(const char *str);
 
+    /// Print a static text, rendered at compile time via `SDA5708_STATIC_TEXT()` and stored in flash, at the given position.
+    /// Only copies the pre-rendered glyphs, without looking up each character in the font.
+    /// Custom glyphs do not apply to static texts.
+    uint8_t print_static(uint8_t pos, const SDAStaticText &text);
+    /// Print a static text at position 0.
+    uint8_t print_static(const SDAStaticText &text);
+
+#ifdef USE_SDA5708_PROPORTIONAL
+    /// Print `str` with proportional glyph widths at the given position.
+    /// Glyphs only take the columns they light up, packed across the digits, so narrow characters like "1", "." and ":"
+    /// leave room for more text. The layout of recently printed texts is cached, unchanged texts are not laid out again.
+    /// @return The digit after the last digit used.
+    uint8_t print_proportional(uint8_t pos, const char *str);
+    /// Print `str` with proportional glyph widths at position 0.
+    uint8_t print_proportional(const char *str);
+#endif
+
+    /// Set the font bank used by following `print()` calls (and everything based on it). nullptr selects the regular font.
+    /// The bank is remembered per digit, so different banks can be mixed on the screen.
+    void set_font_bank(const SDAFontBank *bank)
+    {
+      this->font_bank_ = bank;
+    }
+
+    /// Get the font bank used by `print()`, or nullptr for the regular font.
+    const SDAFontBank *get_font_bank() const
+    {
+      return this->font_bank_;
+    }
+
+    /// Set the font bank of a single digit, without changing its character.
+    void set_digit_font_bank(const uint8_t digit, const SDAFontBank *bank);
+
+    /// Store a glyph in the glyph cache under the given key. Digits currently showing the glyph are redrawn.
+    /// @return The character the glyph is bound to, to be used with `print()`.
+    char set_cached_glyph(const char *key, const SDAGlyph_t &glyph);
+
+    /// Print the cached glyph with the given key at the given position. Prints a space if the glyph is not cached.
+    uint8_t print_cached_glyph(uint8_t pos, const char *key);
+
+#ifdef USE_SDA5708_STRFTIME
     /// Evaluate the strftime-format and print the result at the given position.
     uint8_t strftime(uint8_t pos, const char *format, ESPTime time) __attribute__((format(strftime, 3, 0)));
 
     /// Evaluate the strftime-format and print the result at position 0.
     uint8_t strftime(const char *format, ESPTime time) __attribute__((format(strftime, 2, 0)));
+#endif
 
     /// Disable automatic redraw (via writer lambda) for a certain number of frames.
     /// The screen buffer is still written to the screen, the lambda is just not called to generate it.
@@ -96,6 +336,503 @@ namespace esphome::sda5708
     /// Manually re-enable automatic redraw after it has been disabled via `pause_automatic_redraw()`.
     void resume_automatic_redraw();
 
+  public: // Graph API
+    /// Show a graph on the whole screen. Text printed afterwards replaces the graph in its digits.
+    /// Until the next `clear()`, changes of the graph are sent to the screen as they happen, without waiting for the next update.
+    void graph(SDAGraph *graph);
+
+#ifdef USE_SENSOR
+    /// Add every new state of the sensor to the graph.
+    void add_graph_sensor(SDAGraph *graph, sensor::Sensor *sensor);
+#endif
+
+  private:
+    /// Graph shown by the writer, and the digits it is shown in (bit 0: digit 0).
+    SDAGraph *graph_ = nullptr;
+    uint8_t graph_digits_ = 0;
+
+    /// Copy the changed graph into the shown content.
+    void apply_graph();
+
+  public: // Layout API
+    /// Show a layout instead of running a writer.
+    /// Fields are written when their source changes, without clearing or re-rendering the rest of the screen.
+    void set_layout(SDALayout *layout);
+
+  private:
+    SDALayout *layout_ = nullptr;
+
+    /// Write the changed layout fields into the display buffer and render their digits.
+    /// @param with_time Also check the time fields.
+    void apply_layout(const bool with_time);
+
+  public: // Page API
+    /// Add a page. The first page added is shown initially.
+    void add_page(SDA5708Page *page);
+
+    /// Show the given page. If the page was rendered before, its cached frame is shown right away
+    /// and the page is re-rendered in the background.
+    void show_page(SDA5708Page *page);
+
+    /// Show the next page, wrapping around after the last page.
+    void show_next_page();
+
+    /// Show the previous page, wrapping around before the first page.
+    void show_previous_page();
+
+    /// Get the currently shown page, or nullptr if no pages are configured.
+    SDA5708Page *get_active_page() const
+    {
+      return this->page_;
+    }
+
+  private:
+    std::vector<SDA5708Page *> pages_;
+    SDA5708Page *page_ = nullptr;
+
+    /// Render the active page, send it to the screen and update its cached frame.
+    void render_active_page();
+
+    /// Step through the pages by the given offset, wrapping around.
+    void show_page_offset(const int offset);
+
+  public: // Animation API
+    /// Start playing a precompiled animation, replacing any animation that is currently playing.
+    /// While an animation is playing, the writer lambda is not called and the display buffer is not sent to the screen.
+    /// @param animation The animation to play.
+    /// @param loop Restart the animation after the last frame (true) or stop after the last frame (false)?
+    void play_animation(const SDAAnimation *animation, const bool loop = false);
+
+    /// Stop the currently playing animation. Normal content is shown again on the next update.
+    void stop_animation();
+
+    /// Is an animation currently playing?
+    bool is_animation_playing() const
+    {
+      return this->animation_ != nullptr;
+    }
+
+  private:
+    const SDAAnimation *animation_ = nullptr;
+    const uint8_t *animation_cursor_ = nullptr;
+    uint16_t animation_frame_ = 0;
+    SDAPackedFrame animation_screen_{};
+    uint32_t animation_frame_start_ = 0;
+    bool animation_loop_ = false;
+
+    /// Send the next animation frame to the screen, directly from the (flash) frame data.
+    void write_next_animation_frame();
+
+  public: // Sequence API
+    /// Run a sequence, cancelling the sequence that is currently running.
+    /// While a sequence runs, it owns the screen: the writer lambda is not called, and messages and animations wait for it to finish.
+    void run_sequence(const SDASequence *sequence);
+
+    /// Stop the running sequence. The last normal content is shown again right away, and rendered again on the next update.
+    void stop_sequence();
+
+    /// Is a sequence currently running?
+    bool is_sequence_running() const
+    {
+      return this->sequence_ != nullptr;
+    }
+
+  private:
+    const SDASequence *sequence_ = nullptr;
+    size_t sequence_step_ = 0;
+    uint32_t sequence_step_start_ = 0;
+
+    /// Scroll columns or blink phases done in the current step.
+    uint16_t sequence_ticks_ = 0;
+
+    /// A fade step changed the brightness, the brightness target is restored when the sequence ends.
+    bool sequence_faded_ = false;
+
+    /// Text of the current step, as sent to the screen.
+    SDAPackedFrame sequence_frame_{};
+
+    /// Start the current step of the sequence.
+    void start_sequence_step(const uint32_t now);
+
+    /// Advance the current step, and move on to the next step once it is done.
+    void process_sequence(const uint32_t now);
+
+    /// Render up to 8 characters of a text into a frame, with the current font bank.
+    void render_text(const char *text, SDAPackedFrame &frame) const;
+
+  public: // Message API
+    /// Show a message for a limited time.
+    /// If a message with the same or higher priority is currently shown, the message is queued.
+    /// If the currently shown message has a lower priority, it is preempted and re-queued with its remaining duration.
+    /// While a message is shown, the writer lambda is not called.
+    /// @param text The text to show. Texts longer than MESSAGE_MAX_LENGTH are truncated.
+    /// @param priority Priority of the message. Higher priority messages preempt lower priority ones.
+    /// @param duration Time to show the message for, in milliseconds. If 0, the message is shown until it is preempted or cleared.
+    /// @param scroll Scroll texts longer than the screen through the screen?
+    /// @param expiry Drop the message if it could not be shown within this time, in milliseconds. If 0, the message never expires.
+    /// @return true if the message is shown or queued, false if the queue is full.
+    bool show_message(const char *text, const uint8_t priority = 0, const uint32_t duration = 5000, const bool scroll = false, const uint32_t expiry = 0);
+
+    /// Remove the current message and all queued messages. Normal content is shown again right away.
+    void clear_messages();
+
+    /// Is a message currently shown?
+    bool is_message_active() const
+    {
+      return this->message_active_;
+    }
+
+  private:
+    SDAMessageQueue message_queue_;
+    SDAMessage active_message_{};
+    bool message_active_ = false;
+    size_t message_length_ = 0;
+    uint32_t message_start_ = 0;
+
+    size_t message_scroll_pos_ = 0;
+    uint32_t message_scroll_last_ = 0;
+    uint32_t message_scroll_interval_ = 300;
+
+    /// Display buffer contents from before the first message was shown, restored once all messages are done.
+    std::array<char, 8> message_saved_buffer_{};
+    SDAPackedFrame message_saved_static_frame_{};
+    uint8_t message_saved_static_digits_ = 0;
+    std::array<const SDAFontBank *, 8> message_saved_font_banks_{};
+
+    /// Handle message duration and scrolling.
+    void process_messages(const uint32_t now);
+
+    /// Make the given message the active message and show it.
+    void activate_message(const SDAMessage &message, const uint32_t now);
+
+    /// End the active message, and show the next queued message or return to normal content.
+    void finish_message(const uint32_t now);
+
+    /// Render the active message into the display buffer and send it to the screen.
+    void render_message();
+
+  public: // Brightness API
+    /// Fade the brightness to the given level over the given time, without blocking.
+    /// @param brightness The brightness level to fade to (0-7, 0: 0%, 7: 100%)
+    /// @param duration The time the fade should take, in milliseconds. If 0, the brightness is set right away.
+    void fade_brightness(const uint8_t brightness, const uint32_t duration);
+
+    /// Is a brightness fade currently running?
+    bool is_fading() const
+    {
+      return this->fade_active_;
+    }
+
+    /// Enable or disable automatic brightness control by the illuminance sensor.
+    void set_auto_brightness(const bool enabled);
+
+    /// Is automatic brightness control by the illuminance sensor enabled?
+    bool get_auto_brightness() const
+    {
+      return this->auto_brightness_;
+    }
+
+    /// Is the night mode schedule currently active?
+    bool is_night_mode_active() const
+    {
+      return this->night_mode_active_;
+    }
+
+  private:
+    /// Last brightness level set by `set_brightness()` or `fade_brightness()`, the target without auto-brightness or night mode.
+    uint8_t manual_brightness_ = 7;
+
+    bool fade_active_ = false;
+    uint8_t fade_target_ = 7;
+    uint32_t fade_step_interval_ = 0;
+    uint32_t fade_last_step_ = 0;
+
+    bool auto_brightness_ = false;
+    /// Brightness level requested by the illuminance sensor, before night mode is applied.
+    uint8_t auto_brightness_level_ = 7;
+    float auto_brightness_min_illuminance_ = 1.0f;
+    float auto_brightness_max_illuminance_ = 1000.0f;
+    uint8_t auto_brightness_min_ = 0;
+    uint8_t auto_brightness_max_ = 7;
+    /// Extra distance (in brightness levels) the sensor has to move past a level boundary to change the level.
+    float auto_brightness_hysteresis_ = 0.25f;
+    /// Time per brightness level step when following the sensor or night mode, in milliseconds.
+    uint32_t auto_brightness_step_interval_ = 250;
+
+    bool night_mode_ = false;
+    bool night_mode_active_ = false;
+    uint8_t night_mode_brightness_ = 1;
+    /// Night mode start and end, in minutes since midnight.
+    uint16_t night_mode_start_ = 22 * 60;
+    uint16_t night_mode_end_ = 7 * 60;
+
+    /// Write the brightness to the control register, if it changed.
+    void write_brightness(const uint8_t brightness);
+
+    /// Fade to the given level like `fade_brightness()`, without changing the manual brightness level.
+    void start_fade(const uint8_t brightness, const uint32_t duration);
+
+    /// Step a running fade, if due.
+    void process_fade(const uint32_t now);
+
+    /// Handle a new illuminance reading.
+    void on_illuminance(const float illuminance);
+
+    /// Re-evaluate the night mode schedule.
+    void check_night_mode();
+
+    /// Fade to the brightness requested by auto-brightness and night mode, at the auto-brightness step rate.
+    void apply_brightness_target();
+
+  public: // Idle & Cadence API
+    /// Register activity: leave idle mode and restore the normal update interval.
+    /// Called automatically when the content changes, a page is switched, a message is shown or an animation starts.
+    void wake();
+
+    /// Is the screen currently idle (blanked or dimmed)?
+    bool is_idle() const
+    {
+      return this->idle_;
+    }
+
+  private:
+    /// Update interval configured by codegen, restored whenever the content changes.
+    uint32_t base_update_interval_ = 0;
+
+    /// Longest update interval to back off to while the content is static. 0 disables backing off.
+    uint32_t max_update_interval_ = 0;
+
+    /// Number of consecutive updates with unchanged content before the update interval is doubled.
+    uint16_t static_updates_threshold_ = 10;
+    uint16_t static_updates_ = 0;
+
+    /// Time without activity before the screen goes idle, in milliseconds. 0 disables idle mode.
+    uint32_t idle_timeout_ = 0;
+
+    /// Brightness to dim to while idle. If negative, the screen is blanked instead.
+    int8_t idle_brightness_ = -1;
+
+    uint32_t last_activity_ = 0;
+    bool idle_ = false;
+    bool idle_blanked_ = false;
+    uint8_t idle_saved_brightness_ = 7;
+
+    /// Track static content after an update, and back off or restore the update interval.
+    /// @param changed Did the content change during this update?
+    void update_cadence(const bool changed);
+
+    /// Change the update interval, restarting the poller if needed.
+    void set_render_interval(const uint32_t interval);
+
+    /// Blank or dim the screen after the idle timeout.
+    void enter_idle();
+
+  public: // Stream API
+    /// Feed received stream data into the stream parser. See `SDAStreamParser` for the protocol.
+    /// Frames are parsed into the stream back frame and sent to the screen once complete.
+    /// While frames are received, the writer lambda is not called.
+    /// @param data The received data.
+    /// @param length Length of the received data.
+    void feed_stream(const uint8_t *data, const size_t length);
+
+    /// Are stream frames currently received?
+    bool is_streaming() const
+    {
+      return this->stream_active_;
+    }
+
+    /// Get the stream parser, e.g. to read the frame, dropped and late counters.
+    const SDAStreamParser &get_stream_parser() const
+    {
+      return this->stream_parser_;
+    }
+
+  private:
+    SDAStreamParser stream_parser_;
+
+    /// Back frame the stream is parsed into.
+    SDAPackedFrame stream_frame_{};
+
+    /// Last complete frame, the back frame is restored to it when a packet is discarded.
+    SDAPackedFrame stream_accepted_frame_{};
+
+    /// Time without frames after which normal content is shown again, in milliseconds.
+    uint32_t stream_timeout_ = 2000;
+    uint32_t stream_last_frame_ = 0;
+    bool stream_active_ = false;
+
+    /// Read from the configured stream transports and handle the stream timeout.
+    void process_stream(const uint32_t now);
+
+#ifdef USE_SDA5708_STREAM_UART
+    uart::UARTComponent *stream_uart_ = nullptr;
+#endif
+#ifdef USE_SDA5708_STREAM_SOCKET
+    uint16_t stream_port_ = 0;
+    std::unique_ptr<socket::Socket> stream_server_;
+    std::unique_ptr<socket::Socket> stream_client_;
+
+    /// Open the stream listening socket.
+    void setup_stream_socket();
+#endif
+
+  public: // Sync API
+#ifdef USE_SDA5708_SYNC
+    /// Time the frame currently rendered is presented at, in microseconds since the epoch.
+    /// Lambdas should render the content for this time instead of the current time, so all screens show the same moment.
+    int64_t get_presentation_time_us() const
+    {
+      return this->sync_next_;
+    }
+
+    /// Time the frame currently rendered is presented at, as local time.
+    ESPTime get_presentation_time() const
+    {
+      return ESPTime::from_epoch_local(this->sync_next_ / 1000000);
+    }
+
+  private:
+    /// Clock of the presentation grid. Only used to require a time source, the grid follows the system clock it sets.
+    time::RealTimeClock *sync_time_ = nullptr;
+
+    /// Distance between two presentation times, and time before a presentation time the frame is rendered, in milliseconds.
+    uint32_t sync_interval_ = 1000;
+    uint32_t sync_lead_ = 50;
+
+    /// Next presentation time, in microseconds since the epoch. 0: not scheduled yet.
+    int64_t sync_next_ = 0;
+
+    /// The frame for the next presentation time was rendered.
+    bool sync_rendered_ = false;
+
+    /// Last frame written, latched at the next presentation time.
+    SDAPackedFrame sync_frame_{};
+    bool sync_pending_ = false;
+
+    /// Write frames straight to the screen instead of buffering them (while latching and benchmarking).
+    bool sync_direct_ = false;
+
+    /// Keeps the main loop running without delays while a frame waits for its presentation time.
+    HighFrequencyLoopRequester sync_loop_requester_;
+
+    /// Current system time, in microseconds since the epoch.
+    static int64_t sync_clock();
+
+    /// Schedule the next presentation time after `time`.
+    void schedule_sync(const int64_t time);
+
+    /// Render the frame for the next presentation time, and latch it once the time is reached.
+    void process_sync();
+#endif
+
+  public: // Benchmark API
+    /// Measure the time it takes to send frames to the screen, and log the results.
+    /// Runs worst-case (all digits changed), best-case (nothing changed) and rotated frames,
+    /// then restores the previous screen contents. Blocks for the duration of the benchmark.
+    /// @param frames Number of frames to measure per case.
+    void run_benchmark(const uint16_t frames);
+
+  private:
+    /// Send `frames` frames, alternating between `a` and `b`, and log the time per frame.
+    void benchmark_case(const char *name, const uint16_t frames, const SDAPackedFrame &a, const SDAPackedFrame &b);
+
+  public: // Bus Trace API
+    /// Log the recorded bus operations, oldest first, as hex records for `tools/sda5708_trace.py`.
+    /// Logs a warning if the bus trace is not enabled.
+    void dump_bus_trace();
+
+#ifdef USE_SDA5708_BUS_TRACE
+    /// Get the recorded bus operations.
+    const SDABusTrace &get_bus_trace() const
+    {
+      return this->bus_trace_;
+    }
+
+  private:
+    /// Last bus operations. Mutable, as it is written from the (const) low-level write functions.
+    mutable SDABusTrace bus_trace_;
+#endif
+
+  public: // Virtual Screen API
+#ifdef USE_SDA5708_VIRTUAL_SCREEN
+    /// Get the emulated screen the bus is decoded into.
+    const SDAVirtualScreen &get_virtual_screen() const
+    {
+      return this->virtual_screen_;
+    }
+
+  private:
+    /// Emulated screen, replaces the pins. Mutable, as it is written from the (const) low-level write functions.
+    mutable SDAVirtualScreen virtual_screen_;
+
+    /// File the virtual screen is written to. Empty: print to the terminal.
+    std::string virtual_screen_file_;
+
+    /// Minimum time between two outputs of the virtual screen, in milliseconds.
+    uint32_t virtual_screen_interval_ = 100;
+    uint32_t virtual_screen_last_output_ = 0;
+
+    /// Output the virtual screen, if changed and due.
+    void process_virtual_screen(const uint32_t now);
+#endif
+
+  public: // Power API
+    /// Estimated supply current of the screen for the content currently shown, in A.
+    /// Based on the number of lit pixels and the brightness and peak current actually written to the screen.
+    float get_estimated_current() const;
+
+  private:
+    /// Estimate the current from the lit pixels? Enabled by codegen.
+    bool power_estimation_ = false;
+
+    /// Current of a single lit pixel at full brightness and peak current, and of the screen without lit pixels, in A.
+    float led_current_ = 0.0f;
+    float base_current_ = 0.0f;
+
+    /// Current budget, in A. Brightness and peak current are lowered to stay below it. 0: no limit.
+    float max_current_ = 0.0f;
+
+    /// Number of lit pixels on the screen.
+    uint16_t lit_pixels_ = 0;
+
+#ifdef USE_SENSOR
+    /// Sensor the estimated current is published to.
+    sensor::Sensor *current_sensor_ = nullptr;
+    uint32_t current_last_publish_ = 0;
+#endif
+
+    /// Estimate the current for the given content and control register settings.
+    float estimate_current(const uint16_t lit_pixels, const uint8_t brightness, const bool low_peak_current) const;
+
+    /// Update the number of lit pixels, and adjust the control register to the current budget.
+    void set_lit_pixels(const uint16_t lit_pixels);
+
+    /// Publish the estimated current, if changed and due.
+    void process_power(const uint32_t now);
+
+  private: // Frame Mirror
+#ifdef USE_TEXT_SENSOR
+    /// Text sensor the screen contents are published to.
+    text_sensor::TextSensor *mirror_sensor_ = nullptr;
+#endif
+
+    /// Minimum time between two mirror publishes, in milliseconds.
+    uint32_t mirror_interval_ = 1000;
+
+    /// Publish only changed digits instead of the full bitmap (except for every `MIRROR_KEYFRAME_INTERVAL`th publish).
+    bool mirror_delta_ = false;
+
+    /// Screen changed since the last mirror publish.
+    bool mirror_pending_ = false;
+    uint32_t mirror_last_publish_ = 0;
+    uint8_t mirror_publish_count_ = 0;
+
+    /// Screen contents at the last mirror publish, for delta publishing.
+    SDAPackedFrame mirror_frame_{};
+
+    /// Publish the screen contents to the mirror sensor, if changed and due.
+    void process_mirror(const uint32_t now);
+
   private: // CodeGen API
     sda5708_writer_t writer_;
     GPIOPin *data_pin_;
@@ -106,8 +843,13 @@ namespace esphome::sda5708
     bool init_peak_current_ = false;
     uint8_t init_brightness_ = 7; // 0-7
 
+#if defined(USE_SDA5708_ROTATION) && defined(SDA5708_ROTATE_SCREEN)
+    /// rotate screen by 180 degrees (mounted upside down), fixed by codegen so rotation folds into constants
+    static constexpr bool rotate_screen_ = SDA5708_ROTATE_SCREEN;
+#elif defined(USE_SDA5708_ROTATION)
     /// rotate screen by 180 degrees (mounted upside down)
     bool rotate_screen_ = false;
+#endif
 
   public:
     void set_writer(sda5708_writer_t &&writer)
@@ -145,10 +887,174 @@ namespace esphome::sda5708
       this->init_brightness_ = brightness;
     }
 
+    void set_fast_gpio(const bool enabled)
+    {
+      this->fast_gpio_enabled_ = enabled;
+    }
+
+    void set_power_estimation(const float led_current, const float base_current)
+    {
+      this->power_estimation_ = true;
+      this->led_current_ = led_current;
+      this->base_current_ = base_current;
+    }
+
+    void set_max_current(const float max_current)
+    {
+      this->max_current_ = max_current;
+    }
+
+#ifdef USE_SENSOR
+    void set_current_sensor(sensor::Sensor *sensor)
+    {
+      this->current_sensor_ = sensor;
+    }
+#endif
+
+#if defined(USE_SDA5708_ROTATION) && !defined(SDA5708_ROTATE_SCREEN)
     void set_rotate_screen(const bool rotate)
     {
       this->rotate_screen_ = rotate;
     }
+#endif
+
+    void set_message_scroll_interval(const uint32_t interval)
+    {
+      this->message_scroll_interval_ = interval;
+    }
+
+#ifdef USE_SENSOR
+    void set_illuminance_sensor(sensor::Sensor *sensor)
+    {
+      this->illuminance_sensor_ = sensor;
+      this->auto_brightness_ = true;
+    }
+#endif
+
+    void set_auto_brightness_illuminance_range(const float min_illuminance, const float max_illuminance)
+    {
+      this->auto_brightness_min_illuminance_ = min_illuminance;
+      this->auto_brightness_max_illuminance_ = max_illuminance;
+    }
+
+    void set_auto_brightness_range(const uint8_t min_brightness, const uint8_t max_brightness)
+    {
+      this->auto_brightness_min_ = min_brightness;
+      this->auto_brightness_max_ = max_brightness;
+    }
+
+    void set_auto_brightness_hysteresis(const float hysteresis)
+    {
+      this->auto_brightness_hysteresis_ = hysteresis;
+    }
+
+    void set_auto_brightness_step_interval(const uint32_t interval)
+    {
+      this->auto_brightness_step_interval_ = interval;
+    }
+
+#ifdef USE_TIME
+    void set_night_mode_time(time::RealTimeClock *time)
+    {
+      this->night_mode_time_ = time;
+      this->night_mode_ = true;
+    }
+#endif
+
+    void set_night_mode_schedule(const uint16_t start, const uint16_t end, const uint8_t brightness)
+    {
+      this->night_mode_start_ = start;
+      this->night_mode_end_ = end;
+      this->night_mode_brightness_ = brightness;
+    }
+
+    void set_adaptive_update(const uint32_t max_interval, const uint16_t static_updates)
+    {
+      this->max_update_interval_ = max_interval;
+      this->static_updates_threshold_ = static_updates;
+    }
+
+    void set_idle_timeout(const uint32_t timeout)
+    {
+      this->idle_timeout_ = timeout;
+    }
+
+    void set_idle_brightness(const uint8_t brightness)
+    {
+      this->idle_brightness_ = brightness;
+    }
+
+#ifdef USE_TEXT_SENSOR
+    void set_mirror_sensor(text_sensor::TextSensor *sensor)
+    {
+      this->mirror_sensor_ = sensor;
+    }
+#endif
+
+    void set_mirror_interval(const uint32_t interval)
+    {
+      this->mirror_interval_ = interval;
+    }
+
+    void set_mirror_delta(const bool delta)
+    {
+      this->mirror_delta_ = delta;
+    }
+
+    void set_stream_timeout(const uint32_t timeout)
+    {
+      this->stream_timeout_ = timeout;
+    }
+
+#ifdef USE_SDA5708_STREAM_UART
+    void set_stream_uart(uart::UARTComponent *uart)
+    {
+      this->stream_uart_ = uart;
+    }
+#endif
+
+#ifdef USE_SDA5708_STREAM_SOCKET
+    void set_stream_port(const uint16_t port)
+    {
+      this->stream_port_ = port;
+    }
+#endif
+
+#ifdef USE_SDA5708_SYNC
+    void set_sync(time::RealTimeClock *time, const uint32_t interval, const uint32_t lead)
+    {
+      this->sync_time_ = time;
+      this->sync_interval_ = interval;
+      this->sync_lead_ = lead;
+    }
+#endif
+
+#ifdef USE_SDA5708_ISR_TRANSMIT
+    void set_shift_frequency(const uint32_t frequency)
+    {
+      this->shift_frequency_ = frequency;
+    }
+#endif
+
+#ifdef USE_SDA5708_VIRTUAL_SCREEN
+    void set_virtual_screen_file(const std::string &file)
+    {
+      this->virtual_screen_file_ = file;
+    }
+
+    void set_virtual_screen_interval(const uint32_t interval)
+    {
+      this->virtual_screen_interval_ = interval;
+    }
+#endif
+
+  private:
+#ifdef USE_SENSOR
+    sensor::Sensor *illuminance_sensor_ = nullptr;
+#endif
+#ifdef USE_TIME
+    time::RealTimeClock *night_mode_time_ = nullptr;
+#endif
 
   public: // High-Level Screen API
     /// send a clear command to the screen
@@ -172,7 +1078,17 @@ namespace esphome::sda5708
     /// Write a raw glyph to the screen.
     /// @param digit The digit to be written (0-7, 0 is the leftmost digit)
     /// @param glyph The glyph data to be written
-    void write_glyph(const uint8_t digit, const SDAGlyph_t &glyph) const;
+    void write_glyph(const uint8_t digit, const SDAGlyph_t &glyph);
+
+    /// Write a frame to the screen. Only digits that differ from what is currently shown are sent.
+    /// @param frame The frame to be written
+    void write_frame(const SDAPackedFrame &frame);
+
+    /// Get the frame currently shown on the screen.
+    const SDAPackedFrame &get_screen_frame() const
+    {
+      return this->screen_frame_;
+    }
 
   private: // Low-Level API
     struct SDAControlRegister
@@ -191,20 +1107,38 @@ namespace esphome::sda5708
 
     SDAControlRegister control_register_;
 
+    /// Control register as last written to the screen, after applying the current budget.
+    mutable SDAControlRegister control_written_;
+
+    /// Mirror of the glyph data currently shown on the screen.
+    SDAPackedFrame screen_frame_{};
+
+    /// Bitmask of digits in `screen_frame_` that match the screen (bit 0: digit 0).
+    uint8_t screen_frame_valid_ = 0;
+
     /// Perform a hardware reset of the screen.
     void screen_reset();
 
-    /// Write control register to the screen.
-    /// @param data Control register data
-    void write_control_register(const SDAControlRegister &data) const;
+    /// Write control register to the screen, applying the current budget.
+    /// @param requested Control register data
+    void write_control_register(const SDAControlRegister &requested) const;
+
+    /// Lower brightness and peak current of control register data to stay within the current budget.
+    void limit_current(SDAControlRegister &data) const;
+
+    /// Send the given digits of a frame to the screen, applying screen rotation, and update the screen mirror.
+    /// @param frame The frame to send.
+    /// @param digits Bitmask of digits to send (bit 0: digit 0).
+    void write_digits(const SDAPackedFrame &frame, const uint8_t digits);
 
     /// Select a digit for subsequent data writing.
-    /// @param digit The digit to select (0-7, 0 is the leftmost digit)
+    /// @param digit The physical digit to select (0-7, 0 is the leftmost digit, regardless of screen rotation)
     void select_digit(const uint8_t digit) const;
 
-    /// Write digit data to the previously selected digit.
-    /// @param data Data to write to the digit.
-    void write_digit_data(const SDAGlyph_t &data) const;
+    /// Write the rows of a digit of a frame to the previously selected digit.
+    /// @param frame The frame to take the data from.
+    /// @param digit The digit of the frame to write.
+    void write_digit_data(const SDAPackedFrame &frame, const uint8_t digit) const;
 
     /// Write a byte to the screen.
     /// @param byte the byte to write.
@@ -212,6 +1146,71 @@ namespace esphome::sda5708
 
     /// Delay for a short time to allow the screen to process commands.
     void screen_delay() const;
+
+    /// Use direct register writes if all pins are internal GPIOs?
+    bool fast_gpio_enabled_ = true;
+
+#ifdef USE_SDA5708_FAST_GPIO
+    /// All pins were resolved to their GPIO registers, `write_byte()` uses the fast path.
+    bool fast_gpio_ = false;
+    SDADataPin fast_data_pin_;
+    SDAClockPin fast_clock_pin_;
+    SDALoadPin fast_load_pin_;
+
+    /// CPU cycles to wait between two edges on the fast path.
+    uint32_t fast_delay_cycles_ = 0;
+
+    /// Resolve the pins for the fast path, if possible.
+    void setup_fast_gpio();
+
+    /// Write a byte to the screen via direct register writes.
+    void write_byte_fast(const uint8_t byte) const;
+
+    /// Wait the minimum time between two edges, by busy-waiting on the cycle counter.
+    inline void fast_delay() const
+    {
+      const uint32_t start = arch_get_cpu_cycle_count();
+      while (arch_get_cpu_cycle_count() - start < this->fast_delay_cycles_)
+      {
+      }
+    }
+#endif
+
+#ifdef USE_SDA5708_ISR_TRANSMIT
+    /// Frequency of the transmit timer, in Hz. Each tick is one step of `SDAShifter`.
+    /// 0 disables interrupt transmit for this screen, the define only builds it in for all screens.
+    uint32_t shift_frequency_ = 0;
+
+    /// The transmit timer is set up, `write_byte()` queues bytes for the transmit interrupt.
+    bool shift_ready_ = false;
+
+    /// The transmit timer is running. Only changed with interrupts disabled, or from the interrupt.
+    mutable volatile bool shift_active_ = false;
+
+    /// Bytes waiting to be sent, and the state of the byte being sent. Mutable, as bytes are queued from the (const) low-level write functions.
+    mutable SDAShiftQueue shift_queue_;
+    SDAShifter shifter_;
+
+#ifdef USE_ESP32
+    gptimer_handle_t shift_timer_ = nullptr;
+#endif
+
+    /// Set up the transmit timer. Requires the fast GPIO path, as the interrupt writes the pins through the GPIO registers.
+    void setup_shift_timer();
+
+    /// Queue a byte for the transmit interrupt, and start the timer if it is not running.
+    void queue_byte(const uint8_t byte) const;
+
+    /// Wait until all queued bytes were sent.
+    void wait_shift_idle() const;
+
+    void start_shift_timer() const;
+    void stop_shift_timer() const;
+
+  public:
+    /// Handle a tick of the transmit timer: advance the shifter and write the pins. Called from the interrupt.
+    static void shift_tick(SDA5708Component *component);
+#endif
   };
 
   template <typename... Ts>
@@ -222,4 +1221,187 @@ namespace esphome::sda5708
 
     void play(const Ts &...x) override { this->parent_->set_brightness(this->brightness_.value(x...)); }
   };
+
+  template <typename... Ts>
+  class FadeBrightnessAction : public Action<Ts...>, public Parented<SDA5708Component>
+  {
+  public:
+    TEMPLATABLE_VALUE(uint8_t, brightness)
+    TEMPLATABLE_VALUE(uint32_t, duration)
+
+    void play(const Ts &...x) override { this->parent_->fade_brightness(this->brightness_.value(x...), this->duration_.value(x...)); }
+  };
+
+  template <typename... Ts>
+  class SetAutoBrightnessAction : public Action<Ts...>, public Parented<SDA5708Component>
+  {
+  public:
+    TEMPLATABLE_VALUE(bool, enabled)
+
+    void play(const Ts &...x) override { this->parent_->set_auto_brightness(this->enabled_.value(x...)); }
+  };
+
+  template <typename... Ts>
+  class WakeAction : public Action<Ts...>, public Parented<SDA5708Component>
+  {
+  public:
+    void play(const Ts &...x) override { this->parent_->wake(); }
+  };
+
+  template <typename... Ts>
+  class PlayAnimationAction : public Action<Ts...>, public Parented<SDA5708Component>
+  {
+  public:
+    TEMPLATABLE_VALUE(bool, loop)
+
+    void set_animation(const SDAAnimation *animation) { this->animation_ = animation; }
+
+    void play(const Ts &...x) override { this->parent_->play_animation(this->animation_, this->loop_.value(x...)); }
+
+  private:
+    const SDAAnimation *animation_;
+  };
+
+  template <typename... Ts>
+  class ShowMessageAction : public Action<Ts...>, public Parented<SDA5708Component>
+  {
+  public:
+    TEMPLATABLE_VALUE(std::string, text)
+    TEMPLATABLE_VALUE(uint8_t, priority)
+    TEMPLATABLE_VALUE(uint32_t, duration)
+    TEMPLATABLE_VALUE(bool, scroll)
+    TEMPLATABLE_VALUE(uint32_t, expiry)
+
+    void play(const Ts &...x) override
+    {
+      const auto text = this->text_.value(x...);
+      this->parent_->show_message(
+          text.c_str(),
+          this->priority_.value(x...),
+          this->duration_.value(x...),
+          this->scroll_.value(x...),
+          this->expiry_.value(x...));
+    }
+  };
+
+  template <typename... Ts>
+  class ClearMessagesAction : public Action<Ts...>, public Parented<SDA5708Component>
+  {
+  public:
+    void play(const Ts &...x) override { this->parent_->clear_messages(); }
+  };
+
+  template <typename... Ts>
+  class SetDigitAttributesAction : public Action<Ts...>, public Parented<SDA5708Component>
+  {
+  public:
+    TEMPLATABLE_VALUE(uint8_t, digit)
+    TEMPLATABLE_VALUE(uint16_t, blink_period)
+    TEMPLATABLE_VALUE(bool, invert)
+    TEMPLATABLE_VALUE(bool, underline)
+
+    void play(const Ts &...x) override
+    {
+      SDADigitAttributes attributes;
+      attributes.blink_period = this->blink_period_.value(x...);
+      attributes.invert = this->invert_.value(x...);
+      attributes.underline = this->underline_.value(x...);
+      this->parent_->set_digit_attributes(this->digit_.value(x...), attributes);
+    }
+  };
+
+  template <typename... Ts>
+  class ShowPageAction : public Action<Ts...>, public Parented<SDA5708Component>
+  {
+  public:
+    void set_page(SDA5708Page *page) { this->page_ = page; }
+
+    void play(const Ts &...x) override { this->parent_->show_page(this->page_); }
+
+  private:
+    SDA5708Page *page_;
+  };
+
+  template <typename... Ts>
+  class SetFontBankAction : public Action<Ts...>, public Parented<SDA5708Component>
+  {
+  public:
+    void set_bank(const SDAFontBank *bank) { this->bank_ = bank; }
+
+    void play(const Ts &...x) override
+    {
+      // redrawn by the next update, which wake() brings forward to the normal update interval
+      this->parent_->set_font_bank(this->bank_);
+      this->parent_->wake();
+    }
+
+  private:
+    const SDAFontBank *bank_ = nullptr;
+  };
+
+  template <typename... Ts>
+  class SetGlyphAction : public Action<Ts...>, public Parented<SDA5708Component>
+  {
+  public:
+    TEMPLATABLE_VALUE(const char *, key)
+    TEMPLATABLE_VALUE(SDAGlyph_t, rows)
+
+    void play(const Ts &...x) override { this->parent_->set_cached_glyph(this->key_.value(x...), this->rows_.value(x...)); }
+  };
+
+  template <typename... Ts>
+  class BenchmarkAction : public Action<Ts...>, public Parented<SDA5708Component>
+  {
+  public:
+    TEMPLATABLE_VALUE(uint16_t, frames)
+
+    void play(const Ts &...x) override { this->parent_->run_benchmark(this->frames_.value(x...)); }
+  };
+
+  template <typename... Ts>
+  class DumpBusTraceAction : public Action<Ts...>, public Parented<SDA5708Component>
+  {
+  public:
+    void play(const Ts &...x) override { this->parent_->dump_bus_trace(); }
+  };
+
+  template <typename... Ts>
+  class NextPageAction : public Action<Ts...>, public Parented<SDA5708Component>
+  {
+  public:
+    void play(const Ts &...x) override { this->parent_->show_next_page(); }
+  };
+
+  template <typename... Ts>
+  class PreviousPageAction : public Action<Ts...>, public Parented<SDA5708Component>
+  {
+  public:
+    void play(const Ts &...x) override { this->parent_->show_previous_page(); }
+  };
+
+  template <typename... Ts>
+  class StopAnimationAction : public Action<Ts...>, public Parented<SDA5708Component>
+  {
+  public:
+    void play(const Ts &...x) override { this->parent_->stop_animation(); }
+  };
+
+  template <typename... Ts>
+  class RunSequenceAction : public Action<Ts...>, public Parented<SDA5708Component>
+  {
+  public:
+    void set_sequence(const SDASequence *sequence) { this->sequence_ = sequence; }
+
+    void play(const Ts &...x) override { this->parent_->run_sequence(this->sequence_); }
+
+  private:
+    const SDASequence *sequence_;
+  };
+
+  template <typename... Ts>
+  class StopSequenceAction : public Action<Ts...>, public Parented<SDA5708Component>
+  {
+  public:
+    void play(const Ts &...x) override { this->parent_->stop_sequence(); }
+  };
 } // namespace esphome::sda5708
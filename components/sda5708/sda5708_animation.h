@@ -0,0 +1,51 @@
+#pragma once
+#include <cstdint>
+
+namespace esphome::sda5708
+{
+  /// Precompiled animation, generated by codegen and stored in flash.
+  ///
+  /// Frames are stored as a contiguous byte stream, ready to be sent to the screen as-is:
+  /// - full frames: 8 digits x 7 rows, one byte per row (56 bytes per frame).
+  /// - delta-encoded frames: one byte mask of changed digits (bit 0: digit 0),
+  ///   followed by 7 row bytes for each changed digit, in ascending digit order.
+  ///   The first frame of a delta-encoded animation always has all digits set.
+  class SDAAnimation
+  {
+  public:
+    SDAAnimation(const uint8_t *data, const uint16_t frame_count, const uint32_t frame_duration, const bool delta_encoded)
+        : data_(data), frame_count_(frame_count), frame_duration_(frame_duration), delta_encoded_(delta_encoded)
+    {
+    }
+
+    /// Pointer to the (flash-resident) frame data.
+    const uint8_t *get_data() const
+    {
+      return this->data_;
+    }
+
+    /// Number of frames in the animation.
+    uint16_t get_frame_count() const
+    {
+      return this->frame_count_;
+    }
+
+    /// Time each frame is shown for, in milliseconds.
+    uint32_t get_frame_duration() const
+    {
+      return this->frame_duration_;
+    }
+
+    /// Are frames stored delta-encoded?
+    bool is_delta_encoded() const
+    {
+      return this->delta_encoded_;
+    }
+
+  private:
+    const uint8_t *data_;
+    uint16_t frame_count_;
+    uint32_t frame_duration_;
+    bool delta_encoded_;
+  };
+} // namespace esphome::sda5708
@@ -0,0 +1,150 @@
+#include "sda5708.h"
+
+#include <algorithm>
+#include <cinttypes>
+
+#include "esphome/core/application.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+
+namespace esphome::sda5708
+{
+  static const char *const TAG = "sda5708.benchmark";
+
+  /// Sub-buckets per power of two of the histogram, so each bucket spans at most 25% of its lower bound.
+  static constexpr uint8_t BENCHMARK_SUB_BUCKETS = 4;
+  static constexpr uint8_t BENCHMARK_BUCKETS = 32 * BENCHMARK_SUB_BUCKETS;
+
+  /// Histogram bucket of a cycle count: values below 4 have their own bucket, larger ones are split by their top 3 bits.
+  static uint8_t benchmark_bucket(const uint32_t cycles)
+  {
+    if (cycles < BENCHMARK_SUB_BUCKETS)
+      return cycles;
+
+    const uint8_t log = 31 - __builtin_clz(cycles);
+    return (log - 1) * BENCHMARK_SUB_BUCKETS + ((cycles >> (log - 2)) & (BENCHMARK_SUB_BUCKETS - 1));
+  }
+
+  /// Lowest cycle count of a histogram bucket.
+  static uint64_t benchmark_bucket_start(const uint8_t bucket)
+  {
+    if (bucket < BENCHMARK_SUB_BUCKETS)
+      return bucket;
+
+    const uint8_t log = bucket / BENCHMARK_SUB_BUCKETS + 1;
+    return static_cast<uint64_t>(BENCHMARK_SUB_BUCKETS + bucket % BENCHMARK_SUB_BUCKETS) << (log - 2);
+  }
+
+#pragma region Benchmark API
+  void SDA5708Component::run_benchmark(const uint16_t frames)
+  {
+    if (frames == 0)
+      return;
+
+    ESP_LOGI(TAG, "Running benchmark with %u frames per case", frames);
+
+    // everything that is changed by the benchmark, restored afterwards
+    const SDAPackedFrame saved_screen = this->screen_frame_;
+    const uint8_t saved_screen_valid = this->screen_frame_valid_;
+    const bool saved_mirror_pending = this->mirror_pending_;
+#ifdef USE_SDA5708_SYNC
+    this->sync_direct_ = true;
+#endif
+
+    // checkerboard and its inverse, so every digit changes with every frame
+    SDAPackedFrame pattern;
+    for (uint8_t row = 0; row < SDAPackedFrame::ROWS; row++)
+      pattern.set_row(row, (row % 2 == 0) ? 0xAAAAAAAAAAULL : 0x5555555555ULL);
+    SDAPackedFrame inverse = pattern;
+    inverse.invert();
+
+    benchmark_case("worst case", frames, pattern, inverse);
+    benchmark_case("best case", frames, pattern, pattern);
+
+#if defined(USE_SDA5708_ROTATION) && defined(SDA5708_ROTATE_SCREEN)
+    // the other rotation is not built in, the cases above ran with the fixed one
+    ESP_LOGI(TAG, "rotated: skipped, rotation is fixed by rotate_screen (%s)", this->rotate_screen_ ? "true" : "false");
+#elif defined(USE_SDA5708_ROTATION)
+    const bool saved_rotate = this->rotate_screen_;
+    this->rotate_screen_ = !saved_rotate;
+    benchmark_case("rotated", frames, pattern, inverse);
+    this->rotate_screen_ = saved_rotate;
+#endif
+
+    // send the previous contents again, including digits that were never written
+    this->screen_frame_valid_ = 0;
+    write_frame(saved_screen);
+    this->screen_frame_valid_ = saved_screen_valid;
+    this->mirror_pending_ = saved_mirror_pending;
+#ifdef USE_SDA5708_SYNC
+    this->sync_direct_ = false;
+#endif
+
+    if (this->idle_blanked_)
+      screen_clear();
+  }
+
+  void SDA5708Component::benchmark_case(const char *name, const uint16_t frames, const SDAPackedFrame &a, const SDAPackedFrame &b)
+  {
+    // running statistics and a log-scale histogram, instead of keeping every sample
+    uint16_t buckets[BENCHMARK_BUCKETS] = {};
+    uint32_t min = UINT32_MAX;
+    uint32_t max = 0;
+    uint64_t sum = 0;
+
+    // start from the first frame, so the first measured frame is a change from a to b
+    write_frame(a);
+
+    for (uint16_t i = 0; i < frames; i++)
+    {
+      const SDAPackedFrame &frame = (i % 2 == 0) ? b : a;
+
+      const uint32_t start = arch_get_cpu_cycle_count();
+      write_frame(frame);
+      const uint32_t cycles = arch_get_cpu_cycle_count() - start;
+
+      min = std::min(min, cycles);
+      max = std::max(max, cycles);
+      sum += cycles;
+      buckets[benchmark_bucket(cycles)]++;
+
+#ifdef USE_SDA5708_ISR_TRANSMIT
+      // only the time to queue the frame is measured, the interrupt sends it in the background
+      wait_shift_idle();
+#endif
+
+      App.feed_wdt();
+    }
+
+    // median and p99 are the upper end of the bucket holding them, capped at the maximum
+    uint32_t median = max;
+    uint32_t p99 = max;
+    const uint32_t median_rank = frames / 2 + 1;
+    const uint32_t p99_rank = (static_cast<uint32_t>(frames) * 99 + 99) / 100;
+    uint32_t count = 0;
+    for (uint8_t bucket = 0; bucket < BENCHMARK_BUCKETS; bucket++)
+    {
+      if (buckets[bucket] == 0)
+        continue;
+
+      const uint32_t end = std::min<uint64_t>(benchmark_bucket_start(bucket + 1) - 1, max);
+      if (count < median_rank && count + buckets[bucket] >= median_rank)
+        median = end;
+      if (count < p99_rank && count + buckets[bucket] >= p99_rank)
+        p99 = end;
+      count += buckets[bucket];
+    }
+
+    const uint32_t cycles_per_us = std::max<uint32_t>(arch_get_cpu_freq_hz() / 1000000, 1);
+    ESP_LOGI(TAG, "%s: min %" PRIu32 " us, mean %" PRIu32 " us, median ~%" PRIu32 " us, p99 ~%" PRIu32 " us, max %" PRIu32 " us (%u frames)",
+             name, min / cycles_per_us, static_cast<uint32_t>(sum / frames / cycles_per_us), median / cycles_per_us,
+             p99 / cycles_per_us, max / cycles_per_us, frames);
+
+    for (uint8_t bucket = 0; bucket < BENCHMARK_BUCKETS; bucket++)
+    {
+      if (buckets[bucket] != 0)
+        ESP_LOGI(TAG, "  >= %8.1f us: %u", static_cast<float>(benchmark_bucket_start(bucket)) / cycles_per_us, buckets[bucket]);
+    }
+  }
+#pragma endregion
+} // namespace esphome::sda5708
@@ -0,0 +1,140 @@
+#include "sda5708.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "esphome/core/log.h"
+
+namespace esphome::sda5708
+{
+  static const char *const TAG = "sda5708.brightness";
+
+#pragma region Brightness API
+  void SDA5708Component::fade_brightness(const uint8_t brightness, const uint32_t duration)
+  {
+    this->manual_brightness_ = brightness & 0b111;
+    start_fade(this->manual_brightness_, duration);
+  }
+
+  void SDA5708Component::start_fade(const uint8_t brightness, const uint32_t duration)
+  {
+    const uint8_t target = brightness & 0b111;
+    const uint8_t current = get_brightness();
+    if (duration == 0 || target == current)
+    {
+      this->fade_active_ = false;
+      write_brightness(target);
+      return;
+    }
+
+    // spread the level steps evenly over the fade duration
+    const uint8_t steps = target > current ? target - current : current - target;
+    this->fade_target_ = target;
+    this->fade_step_interval_ = duration / steps;
+    this->fade_last_step_ = millis();
+    this->fade_active_ = true;
+  }
+
+  void SDA5708Component::set_auto_brightness(const bool enabled)
+  {
+    this->auto_brightness_ = enabled;
+
+#ifdef USE_SENSOR
+    if (enabled && this->illuminance_sensor_ != nullptr && this->illuminance_sensor_->has_state())
+      on_illuminance(this->illuminance_sensor_->state);
+#endif
+  }
+
+  void SDA5708Component::write_brightness(const uint8_t brightness)
+  {
+    // only touch the control register if the level actually changes
+    const uint8_t br = 7 - (brightness & 0b111);
+    if (this->control_register_.m_nBR == br)
+      return;
+
+    this->control_register_.m_nBR = br;
+    write_control_register(this->control_register_);
+  }
+
+  void SDA5708Component::process_fade(const uint32_t now)
+  {
+    if (now - this->fade_last_step_ < this->fade_step_interval_)
+      return;
+
+    this->fade_last_step_ = now;
+
+    const uint8_t current = get_brightness();
+    if (current == this->fade_target_)
+    {
+      this->fade_active_ = false;
+      return;
+    }
+
+    write_brightness(current < this->fade_target_ ? current + 1 : current - 1);
+    if (get_brightness() == this->fade_target_)
+      this->fade_active_ = false;
+  }
+
+  void SDA5708Component::on_illuminance(const float illuminance)
+  {
+    if (!this->auto_brightness_ || std::isnan(illuminance))
+      return;
+
+    // map illuminance logarithmically onto the brightness range, as perceived brightness is roughly logarithmic
+    const float min_lux = std::max(this->auto_brightness_min_illuminance_, 0.01f);
+    const float max_lux = std::max(this->auto_brightness_max_illuminance_, min_lux * 1.01f);
+    const float lux = std::min(std::max(illuminance, min_lux), max_lux);
+    const float ratio = std::log(lux / min_lux) / std::log(max_lux / min_lux);
+    const float level = this->auto_brightness_min_ + ratio * (this->auto_brightness_max_ - this->auto_brightness_min_);
+
+    // only change level once the reading is clearly past the boundary to the next level
+    const float distance = level - this->auto_brightness_level_;
+    if (std::fabs(distance) < 0.5f + this->auto_brightness_hysteresis_)
+      return;
+
+    this->auto_brightness_level_ = static_cast<uint8_t>(std::lround(level));
+    ESP_LOGV(TAG, "Illuminance %.1f lx -> brightness %u", illuminance, this->auto_brightness_level_);
+    apply_brightness_target();
+  }
+
+  void SDA5708Component::check_night_mode()
+  {
+#ifdef USE_TIME
+    if (this->night_mode_time_ == nullptr)
+      return;
+
+    const auto now = this->night_mode_time_->now();
+    if (!now.is_valid())
+      return;
+
+    // the schedule may span midnight (e.g. 22:00 - 07:00)
+    const uint16_t minutes = now.hour * 60 + now.minute;
+    const bool active = this->night_mode_start_ <= this->night_mode_end_
+                            ? (minutes >= this->night_mode_start_ && minutes < this->night_mode_end_)
+                            : (minutes >= this->night_mode_start_ || minutes < this->night_mode_end_);
+
+    if (active == this->night_mode_active_)
+      return;
+
+    this->night_mode_active_ = active;
+    ESP_LOGD(TAG, "Night mode %s", active ? "started" : "ended");
+    apply_brightness_target();
+#endif
+  }
+
+  void SDA5708Component::apply_brightness_target()
+  {
+    // idle brightness takes precedence, the target is applied again on wake-up
+    if (this->idle_)
+      return;
+
+    uint8_t target = this->auto_brightness_ ? this->auto_brightness_level_ : this->manual_brightness_;
+    if (this->night_mode_active_)
+      target = std::min(target, this->night_mode_brightness_);
+
+    const uint8_t current = get_brightness();
+    const uint8_t steps = target > current ? target - current : current - target;
+    start_fade(target, steps * this->auto_brightness_step_interval_);
+  }
+#pragma endregion
+} // namespace esphome::sda5708
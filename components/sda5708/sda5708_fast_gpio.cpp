@@ -0,0 +1,55 @@
+#include "sda5708_fast_gpio.h"
+
+#include <utility>
+
+#if defined(USE_ESP32)
+#include "soc/gpio_reg.h"
+#include "soc/soc_caps.h"
+#elif defined(USE_ESP8266)
+#include <esp8266_peri.h>
+#endif
+
+namespace esphome::sda5708
+{
+  bool SDAFastPin::resolve(GPIOPin *pin)
+  {
+    if (pin == nullptr || !pin->is_internal())
+      return false;
+
+    auto *internal = static_cast<InternalGPIOPin *>(pin);
+    const uint8_t number = internal->get_pin();
+
+#if defined(USE_ESP32)
+#if SOC_GPIO_PIN_COUNT > 32
+    if (number >= 32)
+    {
+      this->set_reg_ = reinterpret_cast<volatile uint32_t *>(GPIO_OUT1_W1TS_REG);
+      this->clear_reg_ = reinterpret_cast<volatile uint32_t *>(GPIO_OUT1_W1TC_REG);
+      this->mask_ = uint32_t(1) << (number - 32);
+    }
+    else
+#endif
+    {
+      this->set_reg_ = reinterpret_cast<volatile uint32_t *>(GPIO_OUT_W1TS_REG);
+      this->clear_reg_ = reinterpret_cast<volatile uint32_t *>(GPIO_OUT_W1TC_REG);
+      this->mask_ = uint32_t(1) << number;
+    }
+#elif defined(USE_ESP8266)
+    // GPIO16 is not part of the regular GPIO registers
+    if (number >= 16)
+      return false;
+
+    this->set_reg_ = &GPOS;
+    this->clear_reg_ = &GPOC;
+    this->mask_ = uint32_t(1) << number;
+#else
+    (void) number;
+    return false;
+#endif
+
+    if (internal->is_inverted())
+      std::swap(this->set_reg_, this->clear_reg_);
+
+    return true;
+  }
+} // namespace esphome::sda5708
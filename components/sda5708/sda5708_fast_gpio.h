@@ -0,0 +1,105 @@
+#pragma once
+#include <cstdint>
+
+#include "esphome/core/defines.h"
+#include "esphome/core/hal.h"
+
+#if defined(USE_ESP32) || defined(USE_ESP8266)
+#define USE_SDA5708_FAST_GPIO
+#endif
+
+// pin numbers emitted by codegen if all pins are internal GPIOs, inversion as a bitmask (bit 0: data, 1: clock, 2: load)
+#if defined(USE_SDA5708_FAST_GPIO) && defined(SDA5708_FIXED_DATA_PIN) && defined(SDA5708_FIXED_CLOCK_PIN) && defined(SDA5708_FIXED_LOAD_PIN)
+#define USE_SDA5708_FIXED_GPIO
+#ifndef SDA5708_FIXED_INVERTED_PINS
+#define SDA5708_FIXED_INVERTED_PINS 0
+#endif
+#endif
+
+#ifdef USE_SDA5708_FIXED_GPIO
+#if defined(USE_ESP32)
+#include "soc/gpio_reg.h"
+#include "soc/soc_caps.h"
+#elif defined(USE_ESP8266)
+#include <esp8266_peri.h>
+#endif
+#endif
+
+namespace esphome::sda5708
+{
+  /// Output pin written directly through the GPIO set/clear registers, bypassing the virtual `GPIOPin` interface.
+  /// Only internal GPIOs can be resolved, pins on I/O expanders have to use the generic path.
+  class SDAFastPin
+  {
+  public:
+    /// Resolve a pin to its output registers and mask. Inverted pins swap the set and clear registers.
+    /// @return true if the pin can be written directly, false if it has to use the generic path.
+    bool resolve(GPIOPin *pin);
+
+    /// Set the (logical) level of the pin.
+    inline void write(const bool value) const
+    {
+      *(value ? this->set_reg_ : this->clear_reg_) = this->mask_;
+    }
+
+  private:
+    volatile uint32_t *set_reg_ = nullptr;
+    volatile uint32_t *clear_reg_ = nullptr;
+    uint32_t mask_ = 0;
+  };
+
+#ifdef USE_SDA5708_FIXED_GPIO
+  /// Output pin with registers and mask known at compile time, so writes compile to a single store of constants.
+  /// Drop-in replacement for `SDAFastPin`, used when the pin numbers are fixed by codegen.
+  template <uint8_t PIN, bool INVERTED>
+  class SDAFixedPin
+  {
+  public:
+    /// Check that the configured pin is the pin this class was built for.
+    /// @return true if the pin can be written directly, false if it has to use the generic path.
+    bool resolve(GPIOPin *pin) const
+    {
+      if (pin == nullptr || !pin->is_internal())
+        return false;
+
+      const auto *internal = static_cast<InternalGPIOPin *>(pin);
+      return internal->get_pin() == PIN && internal->is_inverted() == INVERTED;
+    }
+
+    /// Set the (logical) level of the pin.
+    inline void write(const bool value) const
+    {
+#if defined(USE_ESP32)
+      *reinterpret_cast<volatile uint32_t *>(value != INVERTED ? SET_REG : CLEAR_REG) = MASK;
+#elif defined(USE_ESP8266)
+      (value != INVERTED ? GPOS : GPOC) = MASK;
+#endif
+    }
+
+  private:
+#if defined(USE_ESP32)
+#if SOC_GPIO_PIN_COUNT > 32
+    static constexpr uint32_t SET_REG = PIN >= 32 ? GPIO_OUT1_W1TS_REG : GPIO_OUT_W1TS_REG;
+    static constexpr uint32_t CLEAR_REG = PIN >= 32 ? GPIO_OUT1_W1TC_REG : GPIO_OUT_W1TC_REG;
+    static constexpr uint32_t MASK = uint32_t(1) << (PIN % 32);
+#else
+    static constexpr uint32_t SET_REG = GPIO_OUT_W1TS_REG;
+    static constexpr uint32_t CLEAR_REG = GPIO_OUT_W1TC_REG;
+    static constexpr uint32_t MASK = uint32_t(1) << PIN;
+#endif
+#elif defined(USE_ESP8266)
+    // GPIO16 is not part of the regular GPIO registers, codegen does not fix it
+    static_assert(PIN < 16, "GPIO16 cannot be written through the GPIO registers");
+    static constexpr uint32_t MASK = uint32_t(1) << PIN;
+#endif
+  };
+
+  using SDADataPin = SDAFixedPin<SDA5708_FIXED_DATA_PIN, (SDA5708_FIXED_INVERTED_PINS & 0b001) != 0>;
+  using SDAClockPin = SDAFixedPin<SDA5708_FIXED_CLOCK_PIN, (SDA5708_FIXED_INVERTED_PINS & 0b010) != 0>;
+  using SDALoadPin = SDAFixedPin<SDA5708_FIXED_LOAD_PIN, (SDA5708_FIXED_INVERTED_PINS & 0b100) != 0>;
+#else
+  using SDADataPin = SDAFastPin;
+  using SDAClockPin = SDAFastPin;
+  using SDALoadPin = SDAFastPin;
+#endif
+} // namespace esphome::sda5708
@@ -1,849 +1,56 @@
 #include "sda5708.h"
 
+#include "esphome/core/helpers.h"
+
 namespace esphome::sda5708
 {
-#pragma region Default Glyphs
-  // default font based on https://github.com/petabyt/font/blob/master/font.h
-  const std::map<char, SDAGlyph_t> SDA5708Font::default_glyphs_ = {
-      {' ', {
-                0b00000, //
-                0b00000, //
-                0b00000, //
-                0b00000, //
-                0b00000, //
-                0b00000, //
-                0b00000, //
-            }},
-      {'A', {
-                0b01110, //  ###
-                0b10001, // #   #
-                0b10001, // #   #
-                0b10001, // #   #
-                0b11111, // #####
-                0b10001, // #   #
-                0b10001, // #   #
-            }},
-      {'B', {
-                0b11110, // ####
-                0b10001, // #   #
-                0b10001, // #   #
-                0b11110, // ####
-                0b10001, // #   #
-                0b10001, // #   #
-                0b11110, // ####
-            }},
-      {'C', {
-                0b01111, //  ####
-                0b10000, // #
-                0b10000, // #
-                0b10000, // #
-                0b10000, // #
-                0b10000, // #
-                0b01111, //  ####
-            }},
-      {'D', {
-                0b11110, // ####
-                0b10001, // #   #
-                0b10001, // #   #
-                0b10001, // #   #
-                0b10001, // #   #
-                0b10001, // #   #
-                0b11110, // ####
-            }},
-      {'E', {
-                0b11111, // #####
-                0b10000, // #
-                0b10000, // #
-                0b11111, // #####
-                0b10000, // #
-                0b10000, // #
-                0b11111, // #####
-            }},
-      {'F', {
-                0b11111, // #####
-                0b10000, // #
-                0b10000, // #
-                0b11111, // #####
-                0b10000, // #
-                0b10000, // #
-                0b10000, // #
-            }},
-      {'G', {
-                0b01111, //  ####
-                0b10000, // #
-                0b10000, // #
-                0b10011, // #  ##
-                0b10001, // #   #
-                0b10001, // #   #
-                0b01111, //  ####
-            }},
-      {'H', {
-                0b10001, // #   #
-                0b10001, // #   #
-                0b10001, // #   #
-                0b11111, // #####
-                0b10001, // #   #
-                0b10001, // #   #
-                0b10001, // #   #
-            }},
-      {'I', {
-                0b10000, // #
-                0b10000, // #
-                0b10000, // #
-                0b10000, // #
-                0b10000, // #
-                0b10000, // #
-                0b10000, // #
-            }},
-      {'J', {
-                0b00001, //     #
-                0b00001, //     #
-                0b00001, //     #
-                0b00001, //     #
-                0b00001, //     #
-                0b00001, //     #
-                0b11110, // ####
-            }},
-      {'K', {
-                0b10001, // #   #
-                0b10010, // #  #
-                0b10100, // # #
-                0b11000, // ##
-                0b10100, // # #
-                0b10010, // #  #
-                0b10001, // #   #
-            }},
-      {'L', {
-                0b10000, // #
-                0b10000, // #
-                0b10000, // #
-                0b10000, // #
-                0b10000, // #
-                0b10000, // #
-                0b11111, // #####
-            }},
-      {'M', {
-                0b10001, // #   #
-                0b11011, // ## ##
-                0b10101, // # # #
-                0b10001, // #   #
-                0b10001, // #   #
-                0b10001, // #   #
-                0b10001, // #   #
-            }},
-      {'N', {
-                0b10001, // #   #
-                0b11001, // ##  #
-                0b10101, // # # #
-                0b10011, // #  ##
-                0b10001, // #   #
-                0b10001, // #   #
-                0b10001, // #   #
-            }},
-      {'O', {
-                0b01110, //  ###
-                0b10001, // #   #
-                0b10001, // #   #
-                0b10001, // #   #
-                0b10001, // #   #
-                0b10001, // #   #
-                0b01110, //  ###
-            }},
-      {'P', {
-                0b11110, // ####
-                0b10001, // #   #
-                0b10001, // #   #
-                0b11110, // ####
-                0b10000, // #
-                0b10000, // #
-                0b10000, // #
-            }},
-      {'Q', {
-                0b01110, //  ###
-                0b10001, // #   #
-                0b10001, // #   #
-                0b10001, // #   #
-                0b10001, // #   #
-                0b10011, // #  ##
-                0b01111, //  ####
-            }},
-      {'R', {
-                0b11110, // ####
-                0b10001, // #   #
-                0b10001, // #   #
-                0b10001, // #   #
-                0b11110, // ####
-                0b10001, // #   #
-                0b10001, // #   #
-            }},
-      {'S', {
-                0b01111, //  ####
-                0b10000, // #
-                0b10000, // #
-                0b01110, //  ###
-                0b00001, //     #
-                0b00001, //     #
-                0b11110, // ####
-            }},
-      {'T', {
-                0b11111, // #####
-                0b00100, //   #
-                0b00100, //   #
-                0b00100, //   #
-                0b00100, //   #
-                0b00100, //   #
-                0b00100, //   #
-            }},
-      {'U', {
-                0b10001, // #   #
-                0b10001, // #   #
-                0b10001, // #   #
-                0b10001, // #   #
-                0b10001, // #   #
-                0b10001, // #   #
-                0b01110, //  ###
-            }},
-      {'V', {
-                0b10001, // #   #
-                0b10001, // #   #
-                0b10001, // #   #
-                0b10001, // #   #
-                0b10001, // #   #
-                0b01010, //  # #
-                0b00100, //   #
-            }},
-      {'W', {
-                0b10001, // #   #
-                0b10001, // #   #
-                0b10001, // #   #
-                0b10001, // #   #
-                0b10101, // # # #
-                0b11011, // ## ##
-                0b10001, // #   #
-            }},
-      {'X', {
-                0b10001, // #   #
-                0b10001, // #   #
-                0b01010, //  # #
-                0b00100, //   #
-                0b01010, //  # #
-                0b10001, // #   #
-                0b10001, // #   #
-            }},
-      {'Y', {
-                0b10001, // #   #
-                0b10001, // #   #
-                0b10001, // #   #
-                0b01110, //  ###
-                0b00100, //   #
-                0b00100, //   #
-                0b00100, //   #
-            }},
-      {'Z', {
-                0b11111, // #####
-                0b00001, //     #
-                0b00010, //    #
-                0b00100, //   #
-                0b01000, //  #
-                0b10000, // #
-                0b11111, // #####
-            }},
-      {'a', {
-                0b00000, //
-                0b00000, //
-                0b01110, //  ###
-                0b00001, //     #
-                0b01111, //  ####
-                0b10001, // #   #
-                0b01111, //  ####
-            }},
-      {'b', {
-                0b10000, // #
-                0b10000, // #
-                0b11110, // ####
-                0b10001, // #   #
-                0b10001, // #   #
-                0b10001, // #   #
-                0b11110, // ####
-            }},
-      {'c', {
-                0b00000, //
-                0b00000, //
-                0b01110, //  ###
-                0b10001, // #   #
-                0b10000, // #
-                0b10001, // #   #
-                0b01110, //  ###
-            }},
-      {'d', {
-                0b00001, //     #
-                0b00001, //     #
-                0b01111, //  ####
-                0b10001, // #   #
-                0b10001, // #   #
-                0b10001, // #   #
-                0b01111, //  ####
-            }},
-      {'e', {
-                0b00000, //
-                0b00000, //
-                0b01110, //  ###
-                0b10001, // #   #
-                0b11111, // #####
-                0b10000, // #
-                0b01111, //  ####
-            }},
-      {'f', {
-                0b00110, //   ##
-                0b01001, //  #  #
-                0b01000, //  #
-                0b11100, // ###
-                0b01000, //  #
-                0b01000, //  #
-                0b01000, //  #
-            }},
-      {'g', {
-                0b00000, //
-                0b01111, //  ####
-                0b10001, // #   #
-                0b10001, // #   #
-                0b01111, //  ####
-                0b00001, //     #
-                0b11110, // ####
-            }},
-      {'h', {
-                0b10000, // #
-                0b10000, // #
-                0b11110, // ####
-                0b10001, // #   #
-                0b10001, // #   #
-                0b10001, // #   #
-                0b10001, // #   #
-            }},
-      {'i', {
-                0b10000, // #
-                0b00000, //
-                0b10000, // #
-                0b10000, // #
-                0b10000, // #
-                0b10000, // #
-                0b10000, // #
-            }},
-      {'j', {
-                0b00001, //     #
-                0b00000, //
-                0b00011, //    ##
-                0b00001, //     #
-                0b00001, //     #
-                0b10001, // #   #
-                0b01110, //  ###
-            }},
-      {'k', {
-                0b10000, // #
-                0b10000, // #
-                0b10001, // #   #
-                0b10010, // #  #
-                0b11100, // ###
-                0b10010, // #  #
-                0b10001, // #   #
-            }},
-      {'l', {
-                0b10000, // #
-                0b10000, // #
-                0b10000, // #
-                0b10000, // #
-                0b10000, // #
-                0b10000, // #
-                0b11000, // ##
-            }},
-      {'m', {
-                0b00000, //
-                0b00000, //
-                0b11110, // ####
-                0b10101, // # # #
-                0b10101, // # # #
-                0b10101, // # # #
-                0b10101, // # # #
-            }},
-      {'n', {
-                0b00000, //
-                0b00000, //
-                0b11110, // ####
-                0b10001, // #   #
-                0b10001, // #   #
-                0b10001, // #   #
-                0b10001, // #   #
-            }},
-      {'o', {
-                0b00000, //
-                0b00000, //
-                0b01110, //  ###
-                0b10001, // #   #
-                0b10001, // #   #
-                0b10001, // #   #
-                0b01110, //  ###
-            }},
-      {'p', {
-                0b00000, //
-                0b01110, //  ###
-                0b01001, //  #  #
-                0b01001, //  #  #
-                0b01110, //  ###
-                0b01000, //  #
-                0b01000, //  #
-            }},
-      {'q', {
-                0b00000, //
-                0b00000, //
-                0b00111, //   ###
-                0b01001, //  #  #
-                0b00111, //   ###
-                0b00001, //     #
-                0b00001, //     #
-            }},
-      {'r', {
-                0b00000, //
-                0b00000, //
-                0b10111, // # ###
-                0b11000, // ##
-                0b10000, // #
-                0b10000, // #
-                0b10000, // #
-            }},
-      {'s', {
-                0b00000, //
-                0b00000, //
-                0b01111, //  ####
-                0b10000, // #
-                0b01110, //  ###
-                0b00001, //     #
-                0b11110, // ####
-            }},
-      {'t', {
-                0b01000, //  #
-                0b01000, //  #
-                0b11100, // ###
-                0b01000, //  #
-                0b01000, //  #
-                0b01000, //  #
-                0b00110, //   ##
-            }},
-      {'u', {
-                0b00000, //
-                0b00000, //
-                0b10001, // #   #
-                0b10001, // #   #
-                0b10001, // #   #
-                0b10001, // #   #
-                0b01110, //  ###
-            }},
-      {'v', {
-                0b00000, //
-                0b00000, //
-                0b10001, // #   #
-                0b10001, // #   #
-                0b10001, // #   #
-                0b01010, //  # #
-                0b00100, //   #
-            }},
-      {'w', {
-                0b00000, //
-                0b00000, //
-                0b10001, // #   #
-                0b10001, // #   #
-                0b10101, // # # #
-                0b10101, // # # #
-                0b01010, //  # #
-            }},
-      {'x', {
-                0b00000, //
-                0b00000, //
-                0b10001, // #   #
-                0b01010, //  # #
-                0b00100, //   #
-                0b01010, //  # #
-                0b10001, // #   #
-            }},
-      {'y', {
-                0b00000, //
-                0b00000, //
-                0b10001, // #   #
-                0b10001, // #   #
-                0b01111, //  ####
-                0b00001, //     #
-                0b11110, // ####
-            }},
-      {'z', {
-                0b00000, //
-                0b00000, //
-                0b11111, // #####
-                0b00010, //    #
-                0b00100, //   #
-                0b01000, //  #
-                0b11111, // #####
-            }},
-      {'0', {
-                0b01110, //  ###
-                0b10001, // #   #
-                0b10011, // #  ##
-                0b10101, // # # #
-                0b11001, // ##  #
-                0b10001, // #   #
-                0b01110, //  ###
-            }},
-      {'1', {
-                0b11000, // ##
-                0b01000, //  #
-                0b01000, //  #
-                0b01000, //  #
-                0b01000, //  #
-                0b01000, //  #
-                0b01000, //  #
-            }},
-      {'2', {
-                0b01110, //  ###
-                0b10001, // #   #
-                0b00001, //     #
-                0b00110, //   ##
-                0b01000, //  #
-                0b10000, // #
-                0b11111, // #####
-            }},
-      {'3', {
-                0b11110, // ####
-                0b00001, //     #
-                0b00001, //     #
-                0b01110, //  ###
-                0b00001, //     #
-                0b00001, //     #
-                0b11110, // ####
-            }},
-      {'4', {
-                0b10001, // #   #
-                0b10001, // #   #
-                0b10001, // #   #
-                0b11111, // #####
-                0b00001, //     #
-                0b00001, //     #
-                0b00001, //     #
-            }},
-      {'5', {
-                0b11111, // #####
-                0b10000, // #
-                0b10000, // #
-                0b11110, // ####
-                0b00001, //     #
-                0b00001, //     #
-                0b11110, // ####
-            }},
-      {'6', {
-                0b01111, //  ####
-                0b10000, // #
-                0b10000, // #
-                0b01110, //  ###
-                0b10001, // #   #
-                0b10001, // #   #
-                0b01110, //  ###
-            }},
-      {'7', {
-                0b11111, // #####
-                0b00001, //     #
-                0b00001, //     #
-                0b00110, //   ##
-                0b01000, //  #
-                0b01000, //  #
-                0b01000, //  #
-            }},
-      {'8', {
-                0b01110, //  ###
-                0b10001, // #   #
-                0b10001, // #   #
-                0b01110, //  ###
-                0b10001, // #   #
-                0b10001, // #   #
-                0b01110, //  ###
-            }},
-      {'9', {
-                0b01110, //  ###
-                0b10001, // #   #
-                0b10001, // #   #
-                0b01111, //  ####
-                0b00001, //     #
-                0b00001, //     #
-                0b01110, //  ###
-            }},
-      {'!', {
-                0b10000, // #
-                0b10000, // #
-                0b10000, // #
-                0b10000, // #
-                0b10000, // #
-                0b00000, //
-                0b10000, // #
-            }},
-      {'.', {
-                0b00000, //
-                0b00000, //
-                0b00000, //
-                0b00000, //
-                0b00000, //
-                0b00000, //
-                0b10000, // #
-            }},
-      {',', {
-                0b00000, //
-                0b00000, //
-                0b00000, //
-                0b00000, //
-                0b00000, //
-                0b00100, //   #
-                0b01000, //  #
-            }},
-      {'?', {
-                0b01100, //  ##
-                0b10010, // #  #
-                0b00010, //    #
-                0b00100, //   #
-                0b01000, //  #
-                0b00000, //
-                0b01000, //  #
-            }},
-      /*{'', {
-                0b00000, //
-                0b01010, //  # #
-                0b01010, //  # #
-                0b00000, //
-                0b00100, //   #
-                0b10001, // #   #
-                0b01110, //  ###
-            }},*/
-      {'%', {
-                0b00001, //     #
-                0b01001, //  #  #
-                0b00010, //    #
-                0b00100, //   #
-                0b01000, //  #
-                0b10010, // #  #
-                0b10000, // #
-            }},
-      {'#', {
-                0b01010, //  # #
-                0b01010, //  # #
-                0b11111, // #####
-                0b01010, //  # #
-                0b11111, // #####
-                0b01010, //  # #
-                0b01010, //  # #
-            }},
-      {'_', {
-                0b00000, //
-                0b00000, //
-                0b00000, //
-                0b00000, //
-                0b00000, //
-                0b00000, //
-                0b11111, // #####
-            }},
-      {'-', {
-                0b00000, //
-                0b00000, //
-                0b00000, //
-                0b01110, //  ###
-                0b00000, //
-                0b00000, //
-                0b00000, //
-            }},
-      {';', {
-                0b00000, //
-                0b01000, //  #
-                0b00000, //
-                0b01000, //  #
-                0b01000, //  #
-                0b10000, // #
-                0b00000, //
-            }},
-      {'`', {
-                0b01000, //  #
-                0b01000, //  #
-                0b00000, //
-                0b00000, //
-                0b00000, //
-                0b00000, //
-                0b00000, //
-            }},
-      {'=', {
-                0b00000, //
-                0b11111, // #####
-                0b00000, //
-                0b00000, //
-                0b11111, // #####
-                0b00000, //
-                0b00000, //
-            }},
-      {'_', {
-                0b00000, //
-                0b00000, //
-                0b00000, //
-                0b00000, //
-                0b00000, //
-                0b00000, //
-                0b11111, // #####
-            }},
-      {':', {
-                0b00000, //
-                0b01000, //  #
-                0b00000, //
-                0b00000, //
-                0b01000, //  #
-                0b00000, //
-                0b00000, //
-            }},
-      {'<', {
-                0b00010, //    #
-                0b00100, //   #
-                0b01000, //  #
-                0b10000, // #
-                0b01000, //  #
-                0b00100, //   #
-                0b00010, //    #
-            }},
-      {'>', {
-                0b01000, //  #
-                0b00100, //   #
-                0b00010, //    #
-                0b00001, //     #
-                0b00010, //    #
-                0b00100, //   #
-                0b01000, //  #
-            }},
-      {'~', {
-                0b00000, //
-                0b00000, //
-                0b10101, // # # #
-                0b01010, //  # #
-                0b00000, //
-                0b00000, //
-                0b00000, //
-            }},
-      {'*', {
-                0b00100, //   #
-                0b01110, //  ###
-                0b00100, //   #
-                0b01010, //  # #
-                0b00000, //
-                0b00000, //
-                0b00000, //
-            }},
-      {'/', {
-                0b00001, //     #
-                0b00001, //     #
-                0b00010, //    #
-                0b00100, //   #
-                0b01000, //  #
-                0b01000, //  #
-                0b10000, // #
-            }},
-      {'\'', {
-                 0b10000, // #
-                 0b10000, // #
-                 0b10000, // #
-                 0b00000, //
-                 0b00000, //
-                 0b00000, //
-                 0b00000, //
-             }},
-      {'"', {
-                0b10100, // # #
-                0b10100, // # #
-                0b10100, // # #
-                0b00000, //
-                0b00000, //
-                0b00000, //
-                0b00000, //
-            }},
-      {'(', {
-                0b00100, //   #
-                0b01000, //  #
-                0b10000, // #
-                0b10000, // #
-                0b10000, // #
-                0b01000, //  #
-                0b00100, //   #
-            }},
-      {')', {
-                0b10000, // #
-                0b01000, //  #
-                0b00100, //   #
-                0b00100, //   #
-                0b00100, //   #
-                0b01000, //  #
-                0b10000, // #
-            }},
-      {'}', {
-                0b10000, // #
-                0b01000, //  #
-                0b01000, //  #
-                0b00100, //   #
-                0b01000, //  #
-                0b01000, //  #
-                0b10000, // #
-            }},
-      {'{', {
-                0b00100, //   #
-                0b01000, //  #
-                0b01000, //  #
-                0b10000, // #
-                0b01000, //  #
-                0b01000, //  #
-                0b00100, //   #
-            }},
-      {'+', {
-                0b00000, //
-                0b00000, //
-                0b00100, //   #
-                0b00100, //   #
-                0b11111, // #####
-                0b00100, //   #
-                0b00100, //   #
-            }},
-      {'-', {
-                0b00000, //
-                0b00000, //
-                0b00000, //
-                0b00000, //
-                0b11111, // #####
-                0b00000, //
-                0b00000, //
-            }},
-      {'\0', {
-                 0b00000, //
-                 0b00100, //   #
-                 0b01110, //  ###
-                 0b11111, // #####
-                 0b01110, //  ###
-                 0b00100, //   #
-                 0b00000, //
-             }} //
-  };
-#pragma endregion
-
   std::optional<const SDAGlyph_t> SDA5708Font::get_glyph(const char c) const
   {
+    // glyphs set at runtime are bound to their own characters
+    if (SDAGlyphCache::is_slot_char(c))
+    {
+      if (const SDAGlyph_t *glyph = this->glyph_cache_.get_glyph(c); glyph != nullptr)
+        return *glyph;
+    }
+
+#ifdef USE_SDA5708_CUSTOM_GLYPHS
     // check user-defined glyphs first
     auto user_it = this->user_glyphs_.find(c);
     if (user_it != this->user_glyphs_.end())
       return user_it->second;
+#endif
 
     // then check default glyphs
-    auto default_it = this->default_glyphs_.find(c);
-    if (default_it != this->default_glyphs_.end())
-      return default_it->second;
+    if (const SDAGlyph_t *glyph = find_default_glyph(c); glyph != nullptr)
+      return *glyph;
 
     return std::nullopt;
   }
 
+  std::optional<const SDAGlyph_t> SDA5708Font::get_glyph(const char c, const SDAFontBank *bank) const
+  {
+    if (bank != nullptr)
+    {
+      const uint8_t *data = bank->get_data();
+      const uint8_t index = progmem_read_byte(data + static_cast<uint8_t>(c));
+      if (index != NO_GLYPH)
+      {
+        const uint8_t *rows = data + SDAFontBank::INDEX_SIZE + index * SDAPackedFrame::ROWS;
+
+        SDAGlyph_t glyph;
+        for (uint8_t row = 0; row < SDAPackedFrame::ROWS; row++)
+          glyph[row] = progmem_read_byte(rows + row);
+        return glyph;
+      }
+    }
+
+    return get_glyph(c);
+  }
+
+#ifdef USE_SDA5708_CUSTOM_GLYPHS
   void SDA5708Font::set_glyph(const char c, const SDAGlyph_t &glyph)
   {
     this->user_glyphs_[c] = glyph;
   }
+#endif
 }; // namespace esphome::sda5708
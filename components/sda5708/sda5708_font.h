@@ -0,0 +1,1001 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <array>
+
+#include "esphome/core/defines.h"
+#include "sda5708_frame.h"
+
+namespace esphome::sda5708
+{
+  /// A single glyph of the built-in font.
+  struct SDAFontEntry
+  {
+    char c;
+    SDAGlyph_t glyph;
+  };
+
+#pragma region Default Glyphs
+  // default font based on https://github.com/petabyt/font/blob/master/font.h
+  // digits-only builds (without USE_SDA5708_FULL_FONT) keep just the glyphs needed for numbers, times and dates
+  inline constexpr SDAFontEntry DEFAULT_FONT[] = {
+      {' ', {
+                0b00000, //
+                0b00000, //
+                0b00000, //
+                0b00000, //
+                0b00000, //
+                0b00000, //
+                0b00000, //
+            }},
+      {'0', {
+                0b01110, //  ###
+                0b10001, // #   #
+                0b10011, // #  ##
+                0b10101, // # # #
+                0b11001, // ##  #
+                0b10001, // #   #
+                0b01110, //  ###
+            }},
+      {'1', {
+                0b11000, // ##
+                0b01000, //  #
+                0b01000, //  #
+                0b01000, //  #
+                0b01000, //  #
+                0b01000, //  #
+                0b01000, //  #
+            }},
+      {'2', {
+                0b01110, //  ###
+                0b10001, // #   #
+                0b00001, //     #
+                0b00110, //   ##
+                0b01000, //  #
+                0b10000, // #
+                0b11111, // #####
+            }},
+      {'3', {
+                0b11110, // ####
+                0b00001, //     #
+                0b00001, //     #
+                0b01110, //  ###
+                0b00001, //     #
+                0b00001, //     #
+                0b11110, // ####
+            }},
+      {'4', {
+                0b10001, // #   #
+                0b10001, // #   #
+                0b10001, // #   #
+                0b11111, // #####
+                0b00001, //     #
+                0b00001, //     #
+                0b00001, //     #
+            }},
+      {'5', {
+                0b11111, // #####
+                0b10000, // #
+                0b10000, // #
+                0b11110, // ####
+                0b00001, //     #
+                0b00001, //     #
+                0b11110, // ####
+            }},
+      {'6', {
+                0b01111, //  ####
+                0b10000, // #
+                0b10000, // #
+                0b01110, //  ###
+                0b10001, // #   #
+                0b10001, // #   #
+                0b01110, //  ###
+            }},
+      {'7', {
+                0b11111, // #####
+                0b00001, //     #
+                0b00001, //     #
+                0b00110, //   ##
+                0b01000, //  #
+                0b01000, //  #
+                0b01000, //  #
+            }},
+      {'8', {
+                0b01110, //  ###
+                0b10001, // #   #
+                0b10001, // #   #
+                0b01110, //  ###
+                0b10001, // #   #
+                0b10001, // #   #
+                0b01110, //  ###
+            }},
+      {'9', {
+                0b01110, //  ###
+                0b10001, // #   #
+                0b10001, // #   #
+                0b01111, //  ####
+                0b00001, //     #
+                0b00001, //     #
+                0b01110, //  ###
+            }},
+      {'.', {
+                0b00000, //
+                0b00000, //
+                0b00000, //
+                0b00000, //
+                0b00000, //
+                0b00000, //
+                0b10000, // #
+            }},
+      {',', {
+                0b00000, //
+                0b00000, //
+                0b00000, //
+                0b00000, //
+                0b00000, //
+                0b00100, //   #
+                0b01000, //  #
+            }},
+      {'-', {
+                0b00000, //
+                0b00000, //
+                0b00000, //
+                0b01110, //  ###
+                0b00000, //
+                0b00000, //
+                0b00000, //
+            }},
+      {':', {
+                0b00000, //
+                0b01000, //  #
+                0b00000, //
+                0b00000, //
+                0b01000, //  #
+                0b00000, //
+                0b00000, //
+            }},
+      {'+', {
+                0b00000, //
+                0b00000, //
+                0b00100, //   #
+                0b00100, //   #
+                0b11111, // #####
+                0b00100, //   #
+                0b00100, //   #
+            }},
+      {'/', {
+                0b00001, //     #
+                0b00001, //     #
+                0b00010, //    #
+                0b00100, //   #
+                0b01000, //  #
+                0b01000, //  #
+                0b10000, // #
+            }},
+      {'%', {
+                0b00001, //     #
+                0b01001, //  #  #
+                0b00010, //    #
+                0b00100, //   #
+                0b01000, //  #
+                0b10010, // #  #
+                0b10000, // #
+            }},
+#ifdef USE_SDA5708_FULL_FONT
+      {'A', {
+                0b01110, //  ###
+                0b10001, // #   #
+                0b10001, // #   #
+                0b10001, // #   #
+                0b11111, // #####
+                0b10001, // #   #
+                0b10001, // #   #
+            }},
+      {'B', {
+                0b11110, // ####
+                0b10001, // #   #
+                0b10001, // #   #
+                0b11110, // ####
+                0b10001, // #   #
+                0b10001, // #   #
+                0b11110, // ####
+            }},
+      {'C', {
+                0b01111, //  ####
+                0b10000, // #
+                0b10000, // #
+                0b10000, // #
+                0b10000, // #
+                0b10000, // #
+                0b01111, //  ####
+            }},
+      {'D', {
+                0b11110, // ####
+                0b10001, // #   #
+                0b10001, // #   #
+                0b10001, // #   #
+                0b10001, // #   #
+                0b10001, // #   #
+                0b11110, // ####
+            }},
+      {'E', {
+                0b11111, // #####
+                0b10000, // #
+                0b10000, // #
+                0b11111, // #####
+                0b10000, // #
+                0b10000, // #
+                0b11111, // #####
+            }},
+      {'F', {
+                0b11111, // #####
+                0b10000, // #
+                0b10000, // #
+                0b11111, // #####
+                0b10000, // #
+                0b10000, // #
+                0b10000, // #
+            }},
+      {'G', {
+                0b01111, //  ####
+                0b10000, // #
+                0b10000, // #
+                0b10011, // #  ##
+                0b10001, // #   #
+                0b10001, // #   #
+                0b01111, //  ####
+            }},
+      {'H', {
+                0b10001, // #   #
+                0b10001, // #   #
+                0b10001, // #   #
+                0b11111, // #####
+                0b10001, // #   #
+                0b10001, // #   #
+                0b10001, // #   #
+            }},
+      {'I', {
+                0b10000, // #
+                0b10000, // #
+                0b10000, // #
+                0b10000, // #
+                0b10000, // #
+                0b10000, // #
+                0b10000, // #
+            }},
+      {'J', {
+                0b00001, //     #
+                0b00001, //     #
+                0b00001, //     #
+                0b00001, //     #
+                0b00001, //     #
+                0b00001, //     #
+                0b11110, // ####
+            }},
+      {'K', {
+                0b10001, // #   #
+                0b10010, // #  #
+                0b10100, // # #
+                0b11000, // ##
+                0b10100, // # #
+                0b10010, // #  #
+                0b10001, // #   #
+            }},
+      {'L', {
+                0b10000, // #
+                0b10000, // #
+                0b10000, // #
+                0b10000, // #
+                0b10000, // #
+                0b10000, // #
+                0b11111, // #####
+            }},
+      {'M', {
+                0b10001, // #   #
+                0b11011, // ## ##
+                0b10101, // # # #
+                0b10001, // #   #
+                0b10001, // #   #
+                0b10001, // #   #
+                0b10001, // #   #
+            }},
+      {'N', {
+                0b10001, // #   #
+                0b11001, // ##  #
+                0b10101, // # # #
+                0b10011, // #  ##
+                0b10001, // #   #
+                0b10001, // #   #
+                0b10001, // #   #
+            }},
+      {'O', {
+                0b01110, //  ###
+                0b10001, // #   #
+                0b10001, // #   #
+                0b10001, // #   #
+                0b10001, // #   #
+                0b10001, // #   #
+                0b01110, //  ###
+            }},
+      {'P', {
+                0b11110, // ####
+                0b10001, // #   #
+                0b10001, // #   #
+                0b11110, // ####
+                0b10000, // #
+                0b10000, // #
+                0b10000, // #
+            }},
+      {'Q', {
+                0b01110, //  ###
+                0b10001, // #   #
+                0b10001, // #   #
+                0b10001, // #   #
+                0b10001, // #   #
+                0b10011, // #  ##
+                0b01111, //  ####
+            }},
+      {'R', {
+                0b11110, // ####
+                0b10001, // #   #
+                0b10001, // #   #
+                0b10001, // #   #
+                0b11110, // ####
+                0b10001, // #   #
+                0b10001, // #   #
+            }},
+      {'S', {
+                0b01111, //  ####
+                0b10000, // #
+                0b10000, // #
+                0b01110, //  ###
+                0b00001, //     #
+                0b00001, //     #
+                0b11110, // ####
+            }},
+      {'T', {
+                0b11111, // #####
+                0b00100, //   #
+                0b00100, //   #
+                0b00100, //   #
+                0b00100, //   #
+                0b00100, //   #
+                0b00100, //   #
+            }},
+      {'U', {
+                0b10001, // #   #
+                0b10001, // #   #
+                0b10001, // #   #
+                0b10001, // #   #
+                0b10001, // #   #
+                0b10001, // #   #
+                0b01110, //  ###
+            }},
+      {'V', {
+                0b10001, // #   #
+                0b10001, // #   #
+                0b10001, // #   #
+                0b10001, // #   #
+                0b10001, // #   #
+                0b01010, //  # #
+                0b00100, //   #
+            }},
+      {'W', {
+                0b10001, // #   #
+                0b10001, // #   #
+                0b10001, // #   #
+                0b10001, // #   #
+                0b10101, // # # #
+                0b11011, // ## ##
+                0b10001, // #   #
+            }},
+      {'X', {
+                0b10001, // #   #
+                0b10001, // #   #
+                0b01010, //  # #
+                0b00100, //   #
+                0b01010, //  # #
+                0b10001, // #   #
+                0b10001, // #   #
+            }},
+      {'Y', {
+                0b10001, // #   #
+                0b10001, // #   #
+                0b10001, // #   #
+                0b01110, //  ###
+                0b00100, //   #
+                0b00100, //   #
+                0b00100, //   #
+            }},
+      {'Z', {
+                0b11111, // #####
+                0b00001, //     #
+                0b00010, //    #
+                0b00100, //   #
+                0b01000, //  #
+                0b10000, // #
+                0b11111, // #####
+            }},
+      {'a', {
+                0b00000, //
+                0b00000, //
+                0b01110, //  ###
+                0b00001, //     #
+                0b01111, //  ####
+                0b10001, // #   #
+                0b01111, //  ####
+            }},
+      {'b', {
+                0b10000, // #
+                0b10000, // #
+                0b11110, // ####
+                0b10001, // #   #
+                0b10001, // #   #
+                0b10001, // #   #
+                0b11110, // ####
+            }},
+      {'c', {
+                0b00000, //
+                0b00000, //
+                0b01110, //  ###
+                0b10001, // #   #
+                0b10000, // #
+                0b10001, // #   #
+                0b01110, //  ###
+            }},
+      {'d', {
+                0b00001, //     #
+                0b00001, //     #
+                0b01111, //  ####
+                0b10001, // #   #
+                0b10001, // #   #
+                0b10001, // #   #
+                0b01111, //  ####
+            }},
+      {'e', {
+                0b00000, //
+                0b00000, //
+                0b01110, //  ###
+                0b10001, // #   #
+                0b11111, // #####
+                0b10000, // #
+                0b01111, //  ####
+            }},
+      {'f', {
+                0b00110, //   ##
+                0b01001, //  #  #
+                0b01000, //  #
+                0b11100, // ###
+                0b01000, //  #
+                0b01000, //  #
+                0b01000, //  #
+            }},
+      {'g', {
+                0b00000, //
+                0b01111, //  ####
+                0b10001, // #   #
+                0b10001, // #   #
+                0b01111, //  ####
+                0b00001, //     #
+                0b11110, // ####
+            }},
+      {'h', {
+                0b10000, // #
+                0b10000, // #
+                0b11110, // ####
+                0b10001, // #   #
+                0b10001, // #   #
+                0b10001, // #   #
+                0b10001, // #   #
+            }},
+      {'i', {
+                0b10000, // #
+                0b00000, //
+                0b10000, // #
+                0b10000, // #
+                0b10000, // #
+                0b10000, // #
+                0b10000, // #
+            }},
+      {'j', {
+                0b00001, //     #
+                0b00000, //
+                0b00011, //    ##
+                0b00001, //     #
+                0b00001, //     #
+                0b10001, // #   #
+                0b01110, //  ###
+            }},
+      {'k', {
+                0b10000, // #
+                0b10000, // #
+                0b10001, // #   #
+                0b10010, // #  #
+                0b11100, // ###
+                0b10010, // #  #
+                0b10001, // #   #
+            }},
+      {'l', {
+                0b10000, // #
+                0b10000, // #
+                0b10000, // #
+                0b10000, // #
+                0b10000, // #
+                0b10000, // #
+                0b11000, // ##
+            }},
+      {'m', {
+                0b00000, //
+                0b00000, //
+                0b11110, // ####
+                0b10101, // # # #
+                0b10101, // # # #
+                0b10101, // # # #
+                0b10101, // # # #
+            }},
+      {'n', {
+                0b00000, //
+                0b00000, //
+                0b11110, // ####
+                0b10001, // #   #
+                0b10001, // #   #
+                0b10001, // #   #
+                0b10001, // #   #
+            }},
+      {'o', {
+                0b00000, //
+                0b00000, //
+                0b01110, //  ###
+                0b10001, // #   #
+                0b10001, // #   #
+                0b10001, // #   #
+                0b01110, //  ###
+            }},
+      {'p', {
+                0b00000, //
+                0b01110, //  ###
+                0b01001, //  #  #
+                0b01001, //  #  #
+                0b01110, //  ###
+                0b01000, //  #
+                0b01000, //  #
+            }},
+      {'q', {
+                0b00000, //
+                0b00000, //
+                0b00111, //   ###
+                0b01001, //  #  #
+                0b00111, //   ###
+                0b00001, //     #
+                0b00001, //     #
+            }},
+      {'r', {
+                0b00000, //
+                0b00000, //
+                0b10111, // # ###
+                0b11000, // ##
+                0b10000, // #
+                0b10000, // #
+                0b10000, // #
+            }},
+      {'s', {
+                0b00000, //
+                0b00000, //
+                0b01111, //  ####
+                0b10000, // #
+                0b01110, //  ###
+                0b00001, //     #
+                0b11110, // ####
+            }},
+      {'t', {
+                0b01000, //  #
+                0b01000, //  #
+                0b11100, // ###
+                0b01000, //  #
+                0b01000, //  #
+                0b01000, //  #
+                0b00110, //   ##
+            }},
+      {'u', {
+                0b00000, //
+                0b00000, //
+                0b10001, // #   #
+                0b10001, // #   #
+                0b10001, // #   #
+                0b10001, // #   #
+                0b01110, //  ###
+            }},
+      {'v', {
+                0b00000, //
+                0b00000, //
+                0b10001, // #   #
+                0b10001, // #   #
+                0b10001, // #   #
+                0b01010, //  # #
+                0b00100, //   #
+            }},
+      {'w', {
+                0b00000, //
+                0b00000, //
+                0b10001, // #   #
+                0b10001, // #   #
+                0b10101, // # # #
+                0b10101, // # # #
+                0b01010, //  # #
+            }},
+      {'x', {
+                0b00000, //
+                0b00000, //
+                0b10001, // #   #
+                0b01010, //  # #
+                0b00100, //   #
+                0b01010, //  # #
+                0b10001, // #   #
+            }},
+      {'y', {
+                0b00000, //
+                0b00000, //
+                0b10001, // #   #
+                0b10001, // #   #
+                0b01111, //  ####
+                0b00001, //     #
+                0b11110, // ####
+            }},
+      {'z', {
+                0b00000, //
+                0b00000, //
+                0b11111, // #####
+                0b00010, //    #
+                0b00100, //   #
+                0b01000, //  #
+                0b11111, // #####
+            }},
+      {'!', {
+                0b10000, // #
+                0b10000, // #
+                0b10000, // #
+                0b10000, // #
+                0b10000, // #
+                0b00000, //
+                0b10000, // #
+            }},
+      {'?', {
+                0b01100, //  ##
+                0b10010, // #  #
+                0b00010, //    #
+                0b00100, //   #
+                0b01000, //  #
+                0b00000, //
+                0b01000, //  #
+            }},
+      /*{'', {
+                0b00000, //
+                0b01010, //  # #
+                0b01010, //  # #
+                0b00000, //
+                0b00100, //   #
+                0b10001, // #   #
+                0b01110, //  ###
+            }},*/
+      {'#', {
+                0b01010, //  # #
+                0b01010, //  # #
+                0b11111, // #####
+                0b01010, //  # #
+                0b11111, // #####
+                0b01010, //  # #
+                0b01010, //  # #
+            }},
+      {'_', {
+                0b00000, //
+                0b00000, //
+                0b00000, //
+                0b00000, //
+                0b00000, //
+                0b00000, //
+                0b11111, // #####
+            }},
+      {';', {
+                0b00000, //
+                0b01000, //  #
+                0b00000, //
+                0b01000, //  #
+                0b01000, //  #
+                0b10000, // #
+                0b00000, //
+            }},
+      {'`', {
+                0b01000, //  #
+                0b01000, //  #
+                0b00000, //
+                0b00000, //
+                0b00000, //
+                0b00000, //
+                0b00000, //
+            }},
+      {'=', {
+                0b00000, //
+                0b11111, // #####
+                0b00000, //
+                0b00000, //
+                0b11111, // #####
+                0b00000, //
+                0b00000, //
+            }},
+      {'_', {
+                0b00000, //
+                0b00000, //
+                0b00000, //
+                0b00000, //
+                0b00000, //
+                0b00000, //
+                0b11111, // #####
+            }},
+      {'<', {
+                0b00010, //    #
+                0b00100, //   #
+                0b01000, //  #
+                0b10000, // #
+                0b01000, //  #
+                0b00100, //   #
+                0b00010, //    #
+            }},
+      {'>', {
+                0b01000, //  #
+                0b00100, //   #
+                0b00010, //    #
+                0b00001, //     #
+                0b00010, //    #
+                0b00100, //   #
+                0b01000, //  #
+            }},
+      {'~', {
+                0b00000, //
+                0b00000, //
+                0b10101, // # # #
+                0b01010, //  # #
+                0b00000, //
+                0b00000, //
+                0b00000, //
+            }},
+      {'*', {
+                0b00100, //   #
+                0b01110, //  ###
+                0b00100, //   #
+                0b01010, //  # #
+                0b00000, //
+                0b00000, //
+                0b00000, //
+            }},
+      {'\'', {
+                 0b10000, // #
+                 0b10000, // #
+                 0b10000, // #
+                 0b00000, //
+                 0b00000, //
+                 0b00000, //
+                 0b00000, //
+             }},
+      {'"', {
+                0b10100, // # #
+                0b10100, // # #
+                0b10100, // # #
+                0b00000, //
+                0b00000, //
+                0b00000, //
+                0b00000, //
+            }},
+      {'(', {
+                0b00100, //   #
+                0b01000, //  #
+                0b10000, // #
+                0b10000, // #
+                0b10000, // #
+                0b01000, //  #
+                0b00100, //   #
+            }},
+      {')', {
+                0b10000, // #
+                0b01000, //  #
+                0b00100, //   #
+                0b00100, //   #
+                0b00100, //   #
+                0b01000, //  #
+                0b10000, // #
+            }},
+      {'}', {
+                0b10000, // #
+                0b01000, //  #
+                0b01000, //  #
+                0b00100, //   #
+                0b01000, //  #
+                0b01000, //  #
+                0b10000, // #
+            }},
+      {'{', {
+                0b00100, //   #
+                0b01000, //  #
+                0b01000, //  #
+                0b10000, // #
+                0b01000, //  #
+                0b01000, //  #
+                0b00100, //   #
+            }},
+      {'-', {
+                0b00000, //
+                0b00000, //
+                0b00000, //
+                0b00000, //
+                0b11111, // #####
+                0b00000, //
+                0b00000, //
+            }},
+#endif
+      {'\0', {
+                 0b00000, //
+                 0b00100, //   #
+                 0b01110, //  ###
+                 0b11111, // #####
+                 0b01110, //  ###
+                 0b00100, //   #
+                 0b00000, //
+             }} //
+  };
+#pragma endregion
+
+  /// Number of glyphs in the built-in font.
+  inline constexpr size_t DEFAULT_FONT_SIZE = sizeof(DEFAULT_FONT) / sizeof(DEFAULT_FONT[0]);
+
+  /// Marks characters without a built-in glyph in `DEFAULT_FONT_INDEX`.
+  inline constexpr uint8_t NO_GLYPH = 0xFF;
+
+  /// Build the lookup table from (7-bit) character to its index in `DEFAULT_FONT`.
+  /// If a character is defined more than once, the first definition wins.
+  constexpr std::array<uint8_t, 128> build_default_font_index()
+  {
+    std::array<uint8_t, 128> index{};
+    for (auto &entry : index)
+      entry = NO_GLYPH;
+
+    for (size_t i = 0; i < DEFAULT_FONT_SIZE; i++)
+    {
+      const uint8_t c = static_cast<uint8_t>(DEFAULT_FONT[i].c);
+      if (c < index.size() && index[c] == NO_GLYPH)
+        index[c] = i;
+    }
+    return index;
+  }
+
+  /// Index of the built-in glyph of each (7-bit) character, or `NO_GLYPH`.
+  inline constexpr std::array<uint8_t, 128> DEFAULT_FONT_INDEX = build_default_font_index();
+
+  static_assert(DEFAULT_FONT_SIZE < NO_GLYPH, "default font too large for its index");
+
+  /// Get the built-in glyph of a character.
+  /// @return The glyph, or nullptr if the built-in font has no glyph for the character.
+  constexpr const SDAGlyph_t *find_default_glyph(const char c)
+  {
+    const uint8_t code = static_cast<uint8_t>(c);
+    if (code >= DEFAULT_FONT_INDEX.size() || DEFAULT_FONT_INDEX[code] == NO_GLYPH)
+      return nullptr;
+    return &DEFAULT_FONT[DEFAULT_FONT_INDEX[code]].glyph;
+  }
+
+  /// Horizontal extent of the lit columns of a glyph, used to lay out proportional text.
+  struct SDAGlyphSpan
+  {
+    /// Leftmost lit column (0: left).
+    uint8_t first;
+    /// Number of columns from the leftmost to the rightmost lit column, 0 for blank glyphs.
+    uint8_t width;
+  };
+
+  /// Measure the lit columns of a glyph.
+  constexpr SDAGlyphSpan glyph_span(const SDAGlyph_t &glyph)
+  {
+    uint8_t columns = 0;
+    for (const uint8_t row : glyph)
+      columns |= row;
+    columns &= 0b11111;
+
+    SDAGlyphSpan span{};
+    if (columns == 0)
+      return span;
+
+    // bit 4 is the leftmost column
+    uint8_t last = 4;
+    while (!(columns & 1))
+    {
+      columns >>= 1;
+      last--;
+    }
+    uint8_t first = last;
+    while (columns >>= 1)
+      first--;
+
+    span.first = first;
+    span.width = last - first + 1;
+    return span;
+  }
+
+  /// Measure all glyphs of the built-in font.
+  constexpr std::array<SDAGlyphSpan, DEFAULT_FONT_SIZE> build_default_font_spans()
+  {
+    std::array<SDAGlyphSpan, DEFAULT_FONT_SIZE> spans{};
+    for (size_t i = 0; i < DEFAULT_FONT_SIZE; i++)
+      spans[i] = glyph_span(DEFAULT_FONT[i].glyph);
+    return spans;
+  }
+
+  /// Span of each glyph of the built-in font, in the order of `DEFAULT_FONT`. Computed at compile time.
+  inline constexpr std::array<SDAGlyphSpan, DEFAULT_FONT_SIZE> DEFAULT_FONT_SPANS = build_default_font_spans();
+
+  /// A set of glyphs, generated by codegen and stored in flash.
+  /// Glyphs not defined in the bank fall back to the regular font.
+  ///
+  /// The data starts with a 256 byte index (one byte per character, the glyph number or `NO_GLYPH`),
+  /// followed by 7 row bytes for each glyph.
+  class SDAFontBank
+  {
+  public:
+    static constexpr size_t INDEX_SIZE = 256;
+
+    explicit SDAFontBank(const uint8_t *data) : data_(data)
+    {
+    }
+
+    /// Pointer to the (flash-resident) index, followed by the glyph data.
+    const uint8_t *get_data() const
+    {
+      return this->data_;
+    }
+
+  private:
+    const uint8_t *data_;
+  };
+
+  /// A constant string, rendered with the built-in font at compile time and stored in flash (PROGMEM on ESP8266).
+  /// Printing it (see `SDA5708Component::print_static()`) only copies the pre-rendered rows into the frame,
+  /// without any per-character glyph lookup. Create it with `SDA5708_STATIC_TEXT()`.
+  struct SDAStaticText
+  {
+    /// The rendered glyphs, starting at digit 0.
+    SDAPackedFrame frame;
+    /// Number of characters (digits) of the text.
+    uint8_t length;
+  };
+
+  /// Not constexpr on purpose: calling it while rendering a static text at compile time
+  /// aborts the compilation, pointing at the character without a built-in glyph.
+  inline void static_text_missing_glyph() {}
+
+  /// Render a constant string with the built-in font. Only meant to be evaluated at compile time.
+  template <size_t N>
+  constexpr SDAStaticText make_static_text(const char (&text)[N])
+  {
+    static_assert(N - 1 <= SDAPackedFrame::DIGITS, "static text is longer than the screen");
+
+    SDAStaticText result{};
+    result.length = N - 1;
+    for (uint8_t i = 0; i < N - 1; i++)
+    {
+      const SDAGlyph_t *glyph = find_default_glyph(text[i]);
+      if (glyph == nullptr)
+      {
+        static_text_missing_glyph();
+        continue;
+      }
+      result.frame.set_glyph(i, *glyph);
+    }
+    return result;
+  }
+} // namespace esphome::sda5708
+
+/// Render a string literal with the built-in font at compile time, for use with `print_static()`:
+/// `it.print_static(0, SDA5708_STATIC_TEXT("TEMP"));`
+/// Fails to compile if the text is longer than the screen or uses a character without a built-in glyph.
+#define SDA5708_STATIC_TEXT(text) \
+  ([]() -> const ::esphome::sda5708::SDAStaticText & { \
+    static constexpr ::esphome::sda5708::SDAStaticText STATIC_TEXT PROGMEM = ::esphome::sda5708::make_static_text(text); \
+    return STATIC_TEXT; \
+  }())
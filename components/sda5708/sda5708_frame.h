@@ -0,0 +1,269 @@
+#pragma once
+#include <cstdint>
+#include <array>
+
+namespace esphome::sda5708
+{
+  /// Glyph data for a single 5x7 character on the screen.
+  /// Each byte represents one row (of the 7 rows) of the character,
+  /// with the 5 least significant bits representing the 5 columns (1: lit, 0: unlit).
+  typedef std::array<uint8_t, 7> SDAGlyph_t;
+
+  /// Packed pixel data of the whole screen (8 digits x 5 columns x 7 rows = 280 bits).
+  ///
+  /// Each of the 7 rows is stored in a 64-bit word, holding the 40 columns of that row across all digits.
+  /// The leftmost column is the most significant of the 40 bits, so digit 0 occupies bits 39-35 and digit 7 bits 4-0,
+  /// with the same bit order as a glyph row.
+  /// This allows whole-screen operations (invert, compose, scroll, mirror, diff) to work on a row at a time
+  /// instead of on every digit and column separately.
+  class SDAPackedFrame
+  {
+  public:
+    static constexpr uint8_t DIGITS = 8;
+    static constexpr uint8_t ROWS = 7;
+    static constexpr uint8_t DIGIT_COLUMNS = 5;
+    static constexpr uint8_t COLUMNS = DIGITS * DIGIT_COLUMNS;
+
+    /// Size of the frame as a bitmap, see `to_bitmap()`.
+    static constexpr uint8_t BITMAP_ROW_BYTES = COLUMNS / 8;
+    static constexpr uint8_t BITMAP_SIZE = ROWS * BITMAP_ROW_BYTES;
+
+    /// Mask of the valid bits of a row.
+    static constexpr uint64_t ROW_MASK = (uint64_t(1) << COLUMNS) - 1;
+
+    /// Bit position of the rightmost column of a digit within a row.
+    static constexpr uint8_t digit_shift(const uint8_t digit)
+    {
+      return (DIGITS - 1 - digit) * DIGIT_COLUMNS;
+    }
+
+    /// Row mask covering the columns of all digits set in the given bitmask (bit 0: digit 0).
+    static constexpr uint64_t digits_mask(const uint8_t digits)
+    {
+      uint64_t mask = 0;
+      for (uint8_t digit = 0; digit < DIGITS; digit++)
+      {
+        if (digits & (1 << digit))
+          mask |= uint64_t(0b11111) << digit_shift(digit);
+      }
+      return mask;
+    }
+
+    /// Get a single row of the screen, 40 columns wide.
+    constexpr uint64_t get_row(const uint8_t row) const
+    {
+      return this->rows_[row];
+    }
+
+    /// Set a single row of the screen, 40 columns wide.
+    void set_row(const uint8_t row, const uint64_t data)
+    {
+      this->rows_[row] = data & ROW_MASK;
+    }
+
+    /// Get a single row of a digit.
+    uint8_t get_digit_row(const uint8_t digit, const uint8_t row) const
+    {
+      return (this->rows_[row] >> digit_shift(digit)) & 0b11111;
+    }
+
+    /// Set a single row of a digit.
+    void set_digit_row(const uint8_t digit, const uint8_t row, const uint8_t data)
+    {
+      const uint8_t shift = digit_shift(digit);
+      this->rows_[row] = (this->rows_[row] & ~(uint64_t(0b11111) << shift)) | (uint64_t(data & 0b11111) << shift);
+    }
+
+    /// Get the glyph data of a digit.
+    SDAGlyph_t get_glyph(const uint8_t digit) const
+    {
+      SDAGlyph_t glyph;
+      for (uint8_t row = 0; row < ROWS; row++)
+        glyph[row] = get_digit_row(digit, row);
+      return glyph;
+    }
+
+    /// Set the glyph data of a digit.
+    constexpr void set_glyph(const uint8_t digit, const SDAGlyph_t &glyph)
+    {
+      const uint8_t shift = digit_shift(digit);
+      const uint64_t mask = uint64_t(0b11111) << shift;
+      for (uint8_t row = 0; row < ROWS; row++)
+        this->rows_[row] = (this->rows_[row] & ~mask) | (uint64_t(glyph[row] & 0b11111) << shift);
+    }
+
+    /// Copy the digits set in the given bitmask (bit 0: digit 0) from another frame.
+    void copy_digits(const SDAPackedFrame &from, const uint8_t digits)
+    {
+      const uint64_t mask = digits_mask(digits);
+      for (uint8_t row = 0; row < ROWS; row++)
+        this->rows_[row] = (this->rows_[row] & ~mask) | (from.rows_[row] & mask);
+    }
+
+    /// Write the frame as a 35 byte bitmap: the 7 rows with 5 bytes each,
+    /// holding the 40 columns MSB first (the leftmost column is the MSB of the first byte).
+    void to_bitmap(uint8_t *bitmap) const
+    {
+      for (const auto row : this->rows_)
+      {
+        for (int8_t byte = BITMAP_ROW_BYTES - 1; byte >= 0; byte--)
+          *bitmap++ = row >> (byte * 8);
+      }
+    }
+
+    /// Turn off all pixels.
+    void clear()
+    {
+      this->rows_ = {};
+    }
+
+    /// Invert all pixels.
+    void invert()
+    {
+      for (auto &row : this->rows_)
+        row ^= ROW_MASK;
+    }
+
+    /// Invert all pixels of the digits set in the given bitmask (bit 0: digit 0).
+    void invert_digits(const uint8_t digits)
+    {
+      const uint64_t mask = digits_mask(digits);
+      for (auto &row : this->rows_)
+        row ^= mask;
+    }
+
+    /// Turn off all pixels of digits not set in the given bitmask (bit 0: digit 0).
+    void mask_digits(const uint8_t digits)
+    {
+      const uint64_t mask = digits_mask(digits);
+      for (auto &row : this->rows_)
+        row &= mask;
+    }
+
+    /// Keep only pixels that are also lit in the given mask frame.
+    void mask(const SDAPackedFrame &mask)
+    {
+      for (uint8_t row = 0; row < ROWS; row++)
+        this->rows_[row] &= mask.rows_[row];
+    }
+
+    /// Light up all pixels that are lit in the given frame (OR-compose).
+    void compose(const SDAPackedFrame &other)
+    {
+      for (uint8_t row = 0; row < ROWS; row++)
+        this->rows_[row] |= other.rows_[row];
+    }
+
+    /// Shift all columns to the left (content scrolls left), ignoring digit boundaries.
+    /// Columns shifted in on the right are taken from the leftmost columns of `fill`.
+    void shift_left(const uint8_t columns, const SDAPackedFrame &fill)
+    {
+      if (columns == 0)
+        return;
+      if (columns >= COLUMNS)
+      {
+        this->rows_ = fill.rows_;
+        return;
+      }
+
+      for (uint8_t row = 0; row < ROWS; row++)
+        this->rows_[row] = ((this->rows_[row] << columns) | (fill.rows_[row] >> (COLUMNS - columns))) & ROW_MASK;
+    }
+
+    /// Shift all columns to the left (content scrolls left), shifting in unlit columns.
+    void shift_left(const uint8_t columns)
+    {
+      shift_left(columns, SDAPackedFrame());
+    }
+
+    /// Shift all columns to the right (content scrolls right), ignoring digit boundaries.
+    /// Columns shifted in on the left are taken from the rightmost columns of `fill`.
+    void shift_right(const uint8_t columns, const SDAPackedFrame &fill)
+    {
+      if (columns == 0)
+        return;
+      if (columns >= COLUMNS)
+      {
+        this->rows_ = fill.rows_;
+        return;
+      }
+
+      for (uint8_t row = 0; row < ROWS; row++)
+        this->rows_[row] = ((this->rows_[row] >> columns) | (fill.rows_[row] << (COLUMNS - columns))) & ROW_MASK;
+    }
+
+    /// Shift all columns to the right (content scrolls right), shifting in unlit columns.
+    void shift_right(const uint8_t columns)
+    {
+      shift_right(columns, SDAPackedFrame());
+    }
+
+    /// Rotate the frame by 180 degrees (mirror both horizontally and vertically).
+    void mirror()
+    {
+      for (uint8_t row = 0; row < ROWS / 2; row++)
+      {
+        const uint64_t top = this->rows_[row];
+        this->rows_[row] = reverse_row(this->rows_[ROWS - 1 - row]);
+        this->rows_[ROWS - 1 - row] = reverse_row(top);
+      }
+
+      if (ROWS % 2 != 0)
+        this->rows_[ROWS / 2] = reverse_row(this->rows_[ROWS / 2]);
+    }
+
+    /// Get the digits that differ between this frame and another one.
+    /// @return Bitmask of differing digits (bit 0: digit 0).
+    uint8_t diff(const SDAPackedFrame &other) const
+    {
+      uint64_t changed = 0;
+      for (uint8_t row = 0; row < ROWS; row++)
+        changed |= this->rows_[row] ^ other.rows_[row];
+
+      // fold each 5-column group into its lowest bit
+      const uint64_t folded = changed | (changed >> 1) | (changed >> 2) | (changed >> 3) | (changed >> 4);
+
+      uint8_t digits = 0;
+      for (uint8_t digit = 0; digit < DIGITS; digit++)
+      {
+        if ((folded >> digit_shift(digit)) & 1)
+          digits |= (1 << digit);
+      }
+      return digits;
+    }
+
+    /// Count the lit pixels of the frame.
+    uint16_t popcount() const
+    {
+      uint16_t count = 0;
+      for (const auto row : this->rows_)
+        count += __builtin_popcountll(row);
+      return count;
+    }
+
+    bool operator==(const SDAPackedFrame &other) const
+    {
+      return this->rows_ == other.rows_;
+    }
+
+    bool operator!=(const SDAPackedFrame &other) const
+    {
+      return this->rows_ != other.rows_;
+    }
+
+  private:
+    std::array<uint64_t, ROWS> rows_{};
+
+    /// Reverse the order of the 40 columns of a row.
+    static uint64_t reverse_row(uint64_t row)
+    {
+      row = ((row >> 1) & 0x5555555555555555ULL) | ((row & 0x5555555555555555ULL) << 1);
+      row = ((row >> 2) & 0x3333333333333333ULL) | ((row & 0x3333333333333333ULL) << 2);
+      row = ((row >> 4) & 0x0F0F0F0F0F0F0F0FULL) | ((row & 0x0F0F0F0F0F0F0F0FULL) << 4);
+      row = ((row >> 8) & 0x00FF00FF00FF00FFULL) | ((row & 0x00FF00FF00FF00FFULL) << 8);
+      row = ((row >> 16) & 0x0000FFFF0000FFFFULL) | ((row & 0x0000FFFF0000FFFFULL) << 16);
+      row = (row >> 32) | (row << 32);
+      return row >> (64 - COLUMNS);
+    }
+  };
+} // namespace esphome::sda5708
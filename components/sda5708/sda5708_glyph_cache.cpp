@@ -0,0 +1,75 @@
+#include "sda5708_glyph_cache.h"
+
+namespace esphome::sda5708
+{
+  char SDAGlyphCache::put(const uint32_t key, const SDAGlyph_t &glyph, bool &changed)
+  {
+    if (this->slots_.empty())
+    {
+      changed = false;
+      return '\0';
+    }
+
+    // reuse the slot of the key, otherwise the first free or least recently used one
+    size_t target = 0;
+    bool found = false;
+    for (size_t i = 0; i < this->slots_.size(); i++)
+    {
+      const Slot &slot = this->slots_[i];
+      if (slot.used && slot.key == key)
+      {
+        target = i;
+        found = true;
+        break;
+      }
+
+      const Slot &current = this->slots_[target];
+      if (current.used && (!slot.used || slot.last_used < current.last_used))
+        target = i;
+    }
+
+    Slot &slot = this->slots_[target];
+    changed = !found || slot.glyph != glyph;
+
+    slot.key = key;
+    slot.glyph = glyph;
+    slot.used = true;
+    slot.last_used = ++this->clock_;
+    return slot_char(target);
+  }
+
+  char SDAGlyphCache::find(const uint32_t key)
+  {
+    for (size_t i = 0; i < this->slots_.size(); i++)
+    {
+      Slot &slot = this->slots_[i];
+      if (slot.used && slot.key == key)
+      {
+        slot.last_used = ++this->clock_;
+        return slot_char(i);
+      }
+    }
+
+    return '\0';
+  }
+
+  const SDAGlyph_t *SDAGlyphCache::get_glyph(const char c) const
+  {
+    if (!is_slot_char(c))
+      return nullptr;
+
+    const Slot &slot = this->slots_[static_cast<uint8_t>(c) - FIRST_CHAR];
+    return slot.used ? &slot.glyph : nullptr;
+  }
+
+  uint32_t SDAGlyphCache::hash_key(const char *key)
+  {
+    uint32_t hash = 2166136261UL;
+    while (*key != '\0')
+    {
+      hash ^= static_cast<uint8_t>(*key++);
+      hash *= 16777619UL;
+    }
+    return hash;
+  }
+} // namespace esphome::sda5708
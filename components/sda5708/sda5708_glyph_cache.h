@@ -0,0 +1,70 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <array>
+
+#include "sda5708_frame.h"
+
+namespace esphome::sda5708
+{
+#ifndef SDA5708_GLYPH_CACHE_SIZE
+#define SDA5708_GLYPH_CACHE_SIZE 32
+#endif
+
+  /// Fixed-capacity cache of glyphs that are only known at runtime (e.g. icons sent by Home Assistant).
+  /// Each slot is bound to a private-use character, starting at `FIRST_CHAR`, that can be printed like any other character.
+  /// Glyphs are identified by a key. When all slots are in use, the least recently used slot is reused.
+  class SDAGlyphCache
+  {
+  public:
+    /// Character of the first slot.
+    static constexpr uint8_t FIRST_CHAR = 0x80;
+    static constexpr size_t SIZE = SDA5708_GLYPH_CACHE_SIZE;
+
+    static_assert(FIRST_CHAR + SIZE <= 0x100, "glyph cache too large for its character range");
+
+    /// Store a glyph under the given key, reusing the slot of the key or the least recently used slot.
+    /// @param key The key of the glyph, see `hash_key()`.
+    /// @param glyph The glyph data.
+    /// @param changed Set to true if the glyph of the slot changed, so digits showing it have to be redrawn.
+    /// @return The character of the slot.
+    char put(const uint32_t key, const SDAGlyph_t &glyph, bool &changed);
+
+    /// Find the slot of the given key, and mark it as used.
+    /// @return The character of the slot, or '\0' if the key is not cached.
+    char find(const uint32_t key);
+
+    /// Get the glyph of a slot character.
+    /// @return The glyph, or nullptr if the character is not a slot character or the slot is empty.
+    const SDAGlyph_t *get_glyph(const char c) const;
+
+    /// Is the given character a slot character?
+    static bool is_slot_char(const char c)
+    {
+      const uint8_t code = static_cast<uint8_t>(c);
+      return code >= FIRST_CHAR && code < FIRST_CHAR + SIZE;
+    }
+
+    /// Hash a key string (FNV-1a), so slots do not need to store the string itself.
+    static uint32_t hash_key(const char *key);
+
+  private:
+    struct Slot
+    {
+      uint32_t key;
+      uint32_t last_used;
+      SDAGlyph_t glyph;
+      bool used;
+    };
+
+    std::array<Slot, SIZE> slots_{};
+
+    /// Incremented on each access, used to find the least recently used slot.
+    uint32_t clock_ = 0;
+
+    static char slot_char(const size_t slot)
+    {
+      return static_cast<char>(FIRST_CHAR + slot);
+    }
+  };
+} // namespace esphome::sda5708
@@ -0,0 +1,118 @@
+#include "sda5708_graph.h"
+
+#include <cmath>
+
+namespace esphome::sda5708
+{
+  void SDAGraph::push(const float value)
+  {
+    if (this->type_ == SDAGraphType::BAR)
+    {
+      this->values_[0] = value;
+      this->count_ = 1;
+      render();
+      return;
+    }
+
+    this->values_[this->head_] = value;
+    this->head_ = (this->head_ + 1) % COLUMNS;
+    if (this->count_ < COLUMNS)
+      this->count_++;
+
+    // scroll the history by one column and draw the new value on the right
+    this->frame_.shift_left(1);
+    draw_column(COLUMNS - 1, value);
+  }
+
+  void SDAGraph::set_column(const uint8_t column, const float value)
+  {
+    if (this->type_ == SDAGraphType::BAR || column >= COLUMNS)
+      return;
+
+    // the history always covers all columns once columns are set directly
+    this->count_ = COLUMNS;
+    this->values_[(this->head_ + column) % COLUMNS] = value;
+    draw_column(column, value);
+  }
+
+  void SDAGraph::set_range(const float min_value, const float max_value)
+  {
+    this->min_value_ = min_value;
+    this->max_value_ = max_value;
+    render();
+  }
+
+  void SDAGraph::clear()
+  {
+    this->head_ = 0;
+    this->count_ = 0;
+    this->frame_.clear();
+    this->dirty_ = true;
+  }
+
+  float SDAGraph::value_at(const uint8_t column) const
+  {
+    // the newest value is in the rightmost column, columns left of the oldest value are empty
+    const uint8_t empty = COLUMNS - this->count_;
+    if (column < empty)
+      return NAN;
+
+    return this->values_[(this->head_ + column) % COLUMNS];
+  }
+
+  uint8_t SDAGraph::scale(const float value, const uint8_t steps) const
+  {
+    if (std::isnan(value) || this->max_value_ <= this->min_value_)
+      return 0;
+
+    const float scaled = (value - this->min_value_) / (this->max_value_ - this->min_value_) * steps;
+    if (scaled <= 0.0f)
+      return 0;
+    if (scaled >= steps)
+      return steps;
+    return static_cast<uint8_t>(std::lround(scaled));
+  }
+
+  void SDAGraph::draw_column(const uint8_t column, const float value)
+  {
+    const uint64_t bit = uint64_t(1) << (COLUMNS - 1 - column);
+
+    // columns fill up from the bottom row, sparklines light a single row (the bottom row at the minimum)
+    uint8_t lit = 0;
+    if (this->type_ == SDAGraphType::COLUMNS)
+    {
+      lit = (1 << scale(value, ROWS)) - 1;
+    }
+    else if (!std::isnan(value))
+    {
+      lit = 1 << scale(value, ROWS - 1);
+    }
+
+    // bit 0 of `lit` is the bottom row
+    for (uint8_t row = 0; row < ROWS; row++)
+    {
+      const uint64_t data = this->frame_.get_row(row);
+      const bool on = lit & (1 << (ROWS - 1 - row));
+      this->frame_.set_row(row, on ? (data | bit) : (data & ~bit));
+    }
+
+    this->dirty_ = true;
+  }
+
+  void SDAGraph::render()
+  {
+    if (this->type_ == SDAGraphType::BAR)
+    {
+      const uint8_t columns = this->count_ != 0 ? scale(this->values_[0], COLUMNS) : 0;
+      const uint64_t data = columns == 0 ? 0 : (SDAPackedFrame::ROW_MASK << (COLUMNS - columns)) & SDAPackedFrame::ROW_MASK;
+      for (uint8_t row = 0; row < ROWS; row++)
+        this->frame_.set_row(row, data);
+
+      this->dirty_ = true;
+      return;
+    }
+
+    for (uint8_t column = 0; column < COLUMNS; column++)
+      draw_column(column, value_at(column));
+  }
+} // namespace esphome::sda5708
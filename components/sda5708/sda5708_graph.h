@@ -0,0 +1,91 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <array>
+
+#include "sda5708_frame.h"
+
+namespace esphome::sda5708
+{
+  /// How a graph shows its values.
+  enum class SDAGraphType : uint8_t
+  {
+    /// A single horizontal bar across the screen, filled from the left according to the last value.
+    BAR,
+    /// Scrolling history with a filled vertical bar per column, the newest value on the right.
+    COLUMNS,
+    /// Scrolling history with a single dot per column, the newest value on the right.
+    SPARKLINE,
+  };
+
+  /// Renders values as a bar graph or scrolling history, straight into a packed frame spanning the whole screen.
+  /// Adding a value to a history only shifts the frame by one column and draws the new column,
+  /// so graphs can be updated many times per second.
+  class SDAGraph
+  {
+  public:
+    static constexpr uint8_t COLUMNS = SDAPackedFrame::COLUMNS;
+    static constexpr uint8_t ROWS = SDAPackedFrame::ROWS;
+
+    SDAGraph(const SDAGraphType type, const float min_value, const float max_value)
+        : type_(type), min_value_(min_value), max_value_(max_value)
+    {
+    }
+
+    /// Add a value. Bar graphs show it right away, histories scroll left by one column.
+    /// NaN (e.g. an unavailable sensor) is shown as the minimum.
+    void push(const float value);
+
+    /// Set the value of a single column of a history, 0 being the leftmost column.
+    void set_column(const uint8_t column, const float value);
+
+    /// Change the value range, redrawing the graph.
+    void set_range(const float min_value, const float max_value);
+
+    /// Remove all values.
+    void clear();
+
+    /// The rendered graph.
+    const SDAPackedFrame &get_frame() const
+    {
+      return this->frame_;
+    }
+
+    /// Did the graph change since the last `clear_dirty()`?
+    bool is_dirty() const
+    {
+      return this->dirty_;
+    }
+
+    void clear_dirty()
+    {
+      this->dirty_ = false;
+    }
+
+  private:
+    SDAGraphType type_;
+    float min_value_;
+    float max_value_;
+
+    /// Values of the columns (histories) or the last value (bar), index 0 is the oldest value.
+    /// Kept as a ring buffer, so adding a value does not move the others.
+    std::array<float, COLUMNS> values_{};
+    uint8_t head_ = 0;
+    uint8_t count_ = 0;
+
+    SDAPackedFrame frame_{};
+    bool dirty_ = false;
+
+    /// Get the value at the given column, considering the ring buffer and missing values.
+    float value_at(const uint8_t column) const;
+
+    /// Map a value to the range 0..`steps` (rounded, clamped).
+    uint8_t scale(const float value, const uint8_t steps) const;
+
+    /// Draw a single column of a history.
+    void draw_column(const uint8_t column, const float value);
+
+    /// Redraw the whole graph from the stored values.
+    void render();
+  };
+} // namespace esphome::sda5708
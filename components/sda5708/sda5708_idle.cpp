@@ -0,0 +1,97 @@
+#include "sda5708.h"
+
+#include <algorithm>
+#include <cinttypes>
+
+#include "esphome/core/log.h"
+
+namespace esphome::sda5708
+{
+  static const char *const TAG = "sda5708.idle";
+
+#pragma region Idle & Cadence API
+  void SDA5708Component::wake()
+  {
+    this->last_activity_ = millis();
+    this->static_updates_ = 0;
+
+    if (this->base_update_interval_ != 0)
+      set_render_interval(this->base_update_interval_);
+
+    if (!this->idle_)
+      return;
+
+    ESP_LOGD(TAG, "Leaving idle mode");
+    this->idle_ = false;
+
+    if (this->idle_blanked_)
+    {
+      // screen was cleared, so everything has to be sent again
+      this->idle_blanked_ = false;
+      present();
+    }
+    else if (this->auto_brightness_ || this->night_mode_active_)
+    {
+      write_brightness(this->idle_saved_brightness_);
+    }
+
+    // the brightness may have been set while idle, so return to the current target rather than the saved level
+    if (this->auto_brightness_ || this->night_mode_active_)
+      apply_brightness_target();
+    else
+      write_brightness(this->manual_brightness_);
+  }
+
+  void SDA5708Component::update_cadence(const bool changed)
+  {
+    if (changed)
+    {
+      wake();
+      return;
+    }
+
+    if (this->max_update_interval_ == 0)
+      return;
+
+    this->static_updates_++;
+    if (this->static_updates_ < this->static_updates_threshold_)
+      return;
+
+    // content was static for a while, halve the update rate
+    this->static_updates_ = 0;
+    const uint32_t interval = std::min(this->get_update_interval() * 2, this->max_update_interval_);
+    if (interval != this->get_update_interval())
+    {
+      ESP_LOGV(TAG, "Content static, backing off to %" PRIu32 " ms", interval);
+      set_render_interval(interval);
+    }
+  }
+
+  void SDA5708Component::set_render_interval(const uint32_t interval)
+  {
+    if (interval == this->get_update_interval())
+      return;
+
+    this->set_update_interval(interval);
+    this->start_poller();
+  }
+
+  void SDA5708Component::enter_idle()
+  {
+    ESP_LOGD(TAG, "Entering idle mode");
+    this->idle_ = true;
+    this->fade_active_ = false;
+
+    if (this->idle_brightness_ < 0)
+    {
+      this->idle_blanked_ = true;
+      screen_clear();
+    }
+    else
+    {
+      this->idle_saved_brightness_ = get_brightness();
+      write_brightness(this->idle_brightness_);
+    }
+  }
+#pragma endregion
+} // namespace esphome::sda5708
@@ -0,0 +1,167 @@
+#include "sda5708.h"
+
+#include <algorithm>
+#include <cinttypes>
+
+#include "esphome/core/log.h"
+
+namespace esphome::sda5708
+{
+  static const char *const TAG = "sda5708.stream";
+
+  /// Size of the staging buffer transports are read into, before the bytes are parsed into the back frame.
+  static constexpr size_t STREAM_READ_CHUNK = 64;
+  static constexpr uint8_t STREAM_MAX_CHUNKS_PER_LOOP = 8;
+
+#pragma region Stream API
+  void SDA5708Component::feed_stream(const uint8_t *data, const size_t length)
+  {
+    for (size_t i = 0; i < length; i++)
+    {
+      switch (this->stream_parser_.feed(data[i], this->stream_frame_))
+      {
+      case SDAStreamParser::Result::FRAME:
+        if (!this->stream_active_)
+        {
+          ESP_LOGD(TAG, "Stream started");
+          this->stream_active_ = true;
+          wake();
+        }
+
+        this->stream_last_frame_ = millis();
+        this->last_activity_ = this->stream_last_frame_;
+        this->stream_accepted_frame_ = this->stream_frame_;
+        write_frame(this->stream_frame_);
+        break;
+
+      case SDAStreamParser::Result::CONTROL:
+      {
+        const uint8_t control = this->stream_parser_.get_control();
+        set_brightness(control & SDAStreamParser::CONTROL_BRIGHTNESS_MASK);
+
+        const bool low_peak_current = (control & SDAStreamParser::CONTROL_LOW_PEAK_CURRENT) != 0;
+        if (low_peak_current != get_peak_current())
+          set_peak_current(low_peak_current);
+
+        if (control & SDAStreamParser::CONTROL_CLEAR)
+          screen_clear();
+        break;
+      }
+
+      case SDAStreamParser::Result::DISCARDED:
+        // back frame was partially overwritten, restore it to the last accepted frame.
+        // not the screen contents: with sync, that frame may still wait for its presentation time
+        this->stream_frame_ = this->stream_accepted_frame_;
+        break;
+
+      case SDAStreamParser::Result::NONE:
+      default:
+        break;
+      }
+    }
+  }
+
+  void SDA5708Component::process_stream(const uint32_t now)
+  {
+#ifdef USE_SDA5708_STREAM_UART
+    if (this->stream_uart_ != nullptr)
+    {
+      uint8_t buffer[STREAM_READ_CHUNK];
+      for (uint8_t chunk = 0; chunk < STREAM_MAX_CHUNKS_PER_LOOP; chunk++)
+      {
+        const int available = this->stream_uart_->available();
+        if (available <= 0)
+          break;
+
+        const size_t length = std::min<size_t>(available, sizeof(buffer));
+        if (!this->stream_uart_->read_array(buffer, length))
+          break;
+
+        feed_stream(buffer, length);
+      }
+    }
+#endif
+
+#ifdef USE_SDA5708_STREAM_SOCKET
+    if (this->stream_server_ != nullptr && this->stream_client_ == nullptr)
+    {
+      struct sockaddr_storage source_addr;
+      socklen_t addr_len = sizeof(source_addr);
+      this->stream_client_ = this->stream_server_->accept(reinterpret_cast<struct sockaddr *>(&source_addr), &addr_len);
+      if (this->stream_client_ != nullptr)
+      {
+        ESP_LOGD(TAG, "Stream client connected");
+        this->stream_client_->setblocking(false);
+        if (this->stream_parser_.reset())
+          this->stream_frame_ = this->stream_accepted_frame_;
+      }
+    }
+
+    if (this->stream_client_ != nullptr)
+    {
+      uint8_t buffer[STREAM_READ_CHUNK];
+      for (uint8_t chunk = 0; chunk < STREAM_MAX_CHUNKS_PER_LOOP; chunk++)
+      {
+        const ssize_t length = this->stream_client_->read(buffer, sizeof(buffer));
+        if (length > 0)
+        {
+          feed_stream(buffer, length);
+          continue;
+        }
+
+        if (length < 0 && (errno == EWOULDBLOCK || errno == EAGAIN))
+          break;
+
+        // connection closed or failed
+        ESP_LOGD(TAG, "Stream client disconnected");
+        this->stream_client_->close();
+        this->stream_client_ = nullptr;
+        // a packet cut off by the disconnect leaves the back frame partially overwritten
+        if (this->stream_parser_.reset())
+          this->stream_frame_ = this->stream_accepted_frame_;
+        break;
+      }
+    }
+#endif
+
+    if (this->stream_active_ && now - this->stream_last_frame_ >= this->stream_timeout_)
+    {
+      ESP_LOGD(TAG, "Stream timed out (%" PRIu32 " frames, %" PRIu32 " dropped, %" PRIu32 " late)",
+               this->stream_parser_.get_frame_count(),
+               this->stream_parser_.get_dropped_count(),
+               this->stream_parser_.get_late_count());
+
+      // return to the last normal content right away, the next update renders it again
+      this->stream_active_ = false;
+      this->layers_dirty_ = true;
+      wake();
+    }
+  }
+
+#ifdef USE_SDA5708_STREAM_SOCKET
+  void SDA5708Component::setup_stream_socket()
+  {
+    this->stream_server_ = socket::socket_ip(SOCK_STREAM, 0);
+    if (this->stream_server_ == nullptr)
+    {
+      ESP_LOGW(TAG, "Could not create stream socket");
+      return;
+    }
+
+    int enable = 1;
+    this->stream_server_->setsockopt(SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(int));
+    this->stream_server_->setblocking(false);
+
+    struct sockaddr_storage server;
+    const socklen_t sl = socket::set_sockaddr_any(reinterpret_cast<struct sockaddr *>(&server), sizeof(server), this->stream_port_);
+    if (sl == 0 ||
+        this->stream_server_->bind(reinterpret_cast<struct sockaddr *>(&server), sl) != 0 ||
+        this->stream_server_->listen(1) != 0)
+    {
+      ESP_LOGW(TAG, "Could not listen on stream port %u (errno %d)", this->stream_port_, errno);
+      this->stream_server_ = nullptr;
+    }
+  }
+#endif
+#pragma endregion
+} // namespace esphome::sda5708
@@ -0,0 +1,130 @@
+#include "sda5708_layout.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+namespace esphome::sda5708
+{
+  SDALayout::Field &SDALayout::add_field(const FieldType type, const uint8_t pos, const uint8_t width, const SDALayoutAlign align, const char *text)
+  {
+    Field field{};
+    field.type = type;
+    field.pos = std::min(pos, DIGITS);
+    field.width = std::min<uint8_t>(width, DIGITS - field.pos);
+    field.align = align;
+    field.dirty = true;
+    field.text = text;
+
+    this->fields_.push_back(field);
+    this->dirty_ = true;
+    return this->fields_.back();
+  }
+
+  void SDALayout::add_text(const uint8_t pos, const uint8_t width, const char *text)
+  {
+    add_field(FieldType::TEXT, pos, width, SDALayoutAlign::LEFT, text);
+  }
+
+#ifdef USE_SENSOR
+  void SDALayout::add_sensor(const uint8_t pos, const uint8_t width, const SDALayoutAlign align, const char *format, sensor::Sensor *sensor)
+  {
+    add_field(FieldType::SENSOR, pos, width, align, format).sensor = sensor;
+
+    // only mark the field, it is formatted on the next refresh
+    const size_t index = this->fields_.size() - 1;
+    sensor->add_on_state_callback([this, index](float) {
+      this->fields_[index].dirty = true;
+      this->dirty_ = true;
+    });
+  }
+#endif
+
+#ifdef USE_TIME
+  void SDALayout::add_time(const uint8_t pos, const uint8_t width, const SDALayoutAlign align, const char *format, time::RealTimeClock *time)
+  {
+    add_field(FieldType::TIME, pos, width, align, format).time = time;
+  }
+#endif
+
+  uint8_t SDALayout::refresh(char *buffer, const bool with_time)
+  {
+    uint8_t digits = 0;
+    for (auto &field : this->fields_)
+    {
+      if (!field.dirty && !(with_time && field.type == FieldType::TIME))
+        continue;
+
+      field.dirty = false;
+
+      char text[32];
+      format(field, text, sizeof(text));
+
+      // fit the text into the field, padding with blanks
+      const uint8_t length = std::min<size_t>(strlen(text), field.width);
+      const uint8_t padding = field.width - length;
+      const uint8_t start = field.align == SDALayoutAlign::RIGHT ? padding : 0;
+
+      for (uint8_t i = 0; i < field.width; i++)
+      {
+        const char c = i >= start && i < start + length ? text[i - start] : ' ';
+        const uint8_t digit = field.pos + i;
+        if (buffer[digit] != c)
+        {
+          buffer[digit] = c;
+          digits |= (1 << digit);
+        }
+      }
+    }
+
+    this->dirty_ = false;
+    return digits;
+  }
+
+  void SDALayout::format(const Field &field, char *text, const size_t size) const
+  {
+    text[0] = '\0';
+
+    switch (field.type)
+    {
+    case FieldType::TEXT:
+      strncpy(text, field.text, size - 1);
+      text[size - 1] = '\0';
+      return;
+
+    // codegen rejects sensor and time fields if the printf or strftime feature is not built
+#if defined(USE_SENSOR) && defined(USE_SDA5708_PRINTF)
+    case FieldType::SENSOR:
+    {
+      const float state = field.sensor->state;
+      if (std::isnan(state))
+        break;
+
+      snprintf(text, size, field.text, state);
+      return;
+    }
+#endif
+
+#if defined(USE_TIME) && defined(USE_SDA5708_STRFTIME)
+    case FieldType::TIME:
+    {
+      ESPTime now = this->timestamp_ != 0 ? ESPTime::from_epoch_local(this->timestamp_) : field.time->now();
+      if (!now.is_valid())
+        break;
+
+      now.strftime(text, size, field.text);
+      return;
+    }
+#endif
+
+    default:
+      break;
+    }
+
+    // no value, fill the field with dashes
+    const size_t length = std::min<size_t>(field.width, size - 1);
+    memset(text, '-', length);
+    text[length] = '\0';
+  }
+} // namespace esphome::sda5708
@@ -0,0 +1,103 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "esphome/core/defines.h"
+#ifdef USE_SENSOR
+#include "esphome/components/sensor/sensor.h"
+#endif
+#ifdef USE_TIME
+#include "esphome/components/time/real_time_clock.h"
+#endif
+
+namespace esphome::sda5708
+{
+  /// How the content of a layout field is aligned if it is shorter than the field.
+  enum class SDALayoutAlign : uint8_t
+  {
+    LEFT,
+    RIGHT,
+  };
+
+  /// A screen layout made of fields, each bound to a fixed range of digits.
+  /// Fields are only formatted again when their source changed, and only digits whose character changed are reported,
+  /// so the content is updated without clearing and re-rendering the whole screen.
+  class SDALayout
+  {
+  public:
+    static constexpr uint8_t DIGITS = 8;
+
+    /// Add a constant text, e.g. a label or an icon glyph.
+    void add_text(const uint8_t pos, const uint8_t width, const char *text);
+
+#ifdef USE_SENSOR
+    /// Add the state of a sensor, formatted with a printf-style format for a float.
+    /// Unavailable states (NaN) are shown as dashes.
+    void add_sensor(const uint8_t pos, const uint8_t width, const SDALayoutAlign align, const char *format, sensor::Sensor *sensor);
+#endif
+
+#ifdef USE_TIME
+    /// Add the current time, formatted with a strftime-style format. Shown as dashes until the time is valid.
+    void add_time(const uint8_t pos, const uint8_t width, const SDALayoutAlign align, const char *format, time::RealTimeClock *time);
+
+    /// Format time fields for the given time instead of the current time, e.g. the presentation time of synchronized screens.
+    /// @param timestamp UNIX timestamp, 0 for the current time.
+    void set_time(const time_t timestamp)
+    {
+      this->timestamp_ = timestamp;
+    }
+#endif
+
+    /// Format the fields whose source changed (and the time fields, if `with_time` is set) into the display buffer.
+    /// @param buffer The display buffer, one character per digit.
+    /// @param with_time Also format time fields. Time has no change notification, so it is checked on updates.
+    /// @return Bitmask of digits whose character changed (bit 0: digit 0).
+    uint8_t refresh(char *buffer, const bool with_time);
+
+    /// Did a field source change since the last `refresh()`?
+    bool is_dirty() const
+    {
+      return this->dirty_;
+    }
+
+  private:
+    enum class FieldType : uint8_t
+    {
+      TEXT,
+      SENSOR,
+      TIME,
+    };
+
+    struct Field
+    {
+      FieldType type;
+      uint8_t pos;
+      uint8_t width;
+      SDALayoutAlign align;
+      bool dirty;
+
+      /// The text of text fields, the format of all other fields.
+      const char *text;
+
+#ifdef USE_SENSOR
+      sensor::Sensor *sensor;
+#endif
+#ifdef USE_TIME
+      time::RealTimeClock *time;
+#endif
+    };
+
+    std::vector<Field> fields_;
+    bool dirty_ = true;
+
+#ifdef USE_TIME
+    time_t timestamp_ = 0;
+#endif
+
+    Field &add_field(const FieldType type, const uint8_t pos, const uint8_t width, const SDALayoutAlign align, const char *text);
+
+    /// Format the content of a field, not yet fitted to its width.
+    void format(const Field &field, char *text, const size_t size) const;
+  };
+} // namespace esphome::sda5708
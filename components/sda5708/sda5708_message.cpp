@@ -0,0 +1,80 @@
+#include "sda5708_message.h"
+
+namespace esphome::sda5708
+{
+  bool SDAMessageQueue::push(const SDAMessage &message)
+  {
+    if (this->count_ >= this->items_.size() && !drop_lowest_below(message.priority))
+      return false;
+
+    this->at(this->count_) = message;
+    this->count_++;
+    return true;
+  }
+
+  bool SDAMessageQueue::push_front(const SDAMessage &message)
+  {
+    if (this->count_ >= this->items_.size() && !drop_lowest_below(message.priority))
+      return false;
+
+    this->head_ = (this->head_ + this->items_.size() - 1) % this->items_.size();
+    this->at(0) = message;
+    this->count_++;
+    return true;
+  }
+
+  bool SDAMessageQueue::pop(const uint32_t now, SDAMessage &message)
+  {
+    // drop expired messages first
+    size_t i = 0;
+    while (i < this->count_)
+    {
+      if (this->at(i).is_expired(now))
+        remove(i);
+      else
+        i++;
+    }
+
+    if (this->count_ == 0)
+      return false;
+
+    // find the first message with the highest priority
+    size_t best = 0;
+    for (i = 1; i < this->count_; i++)
+    {
+      if (this->at(i).priority > this->at(best).priority)
+        best = i;
+    }
+
+    message = this->at(best);
+    remove(best);
+    return true;
+  }
+
+  void SDAMessageQueue::remove(const size_t index)
+  {
+    for (size_t i = index; i + 1 < this->count_; i++)
+      this->at(i) = this->at(i + 1);
+
+    this->count_--;
+  }
+
+  bool SDAMessageQueue::drop_lowest_below(const uint8_t priority)
+  {
+    if (this->count_ == 0)
+      return false;
+
+    size_t lowest = 0;
+    for (size_t i = 1; i < this->count_; i++)
+    {
+      if (this->at(i).priority < this->at(lowest).priority)
+        lowest = i;
+    }
+
+    if (this->at(lowest).priority >= priority)
+      return false;
+
+    remove(lowest);
+    return true;
+  }
+} // namespace esphome::sda5708
@@ -0,0 +1,93 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <array>
+
+namespace esphome::sda5708
+{
+#ifndef SDA5708_MESSAGE_QUEUE_SIZE
+#define SDA5708_MESSAGE_QUEUE_SIZE 8
+#endif
+
+  /// Maximum length of a message text, excluding the null terminator.
+  static constexpr size_t MESSAGE_MAX_LENGTH = 32;
+
+  /// A message to be shown on the screen for a limited time.
+  struct SDAMessage
+  {
+    /// Text to show. Longer texts are truncated.
+    char text[MESSAGE_MAX_LENGTH + 1];
+
+    /// Priority of the message. Higher priority messages preempt lower priority ones.
+    uint8_t priority;
+
+    /// Scroll the text through the screen (true) or show it statically (false)?
+    bool scroll;
+
+    /// Time to show the message for, in milliseconds. If 0, the message is shown until it is preempted or cleared.
+    uint32_t duration;
+
+    /// Does the message expire if it could not be shown in time?
+    bool expires;
+
+    /// Time (in millis()) at which the message is dropped if it was not shown yet.
+    uint32_t expires_at;
+
+    /// Has the message expired at the given time?
+    bool is_expired(const uint32_t now) const
+    {
+      return this->expires && static_cast<int32_t>(now - this->expires_at) >= 0;
+    }
+  };
+
+  /// Fixed-capacity priority queue of messages, stored in a ring buffer without heap allocation.
+  /// Messages of equal priority are served in insertion order.
+  class SDAMessageQueue
+  {
+  public:
+    /// Add a message to the back of the queue.
+    /// If the queue is full, the oldest message of the lowest priority is dropped if it has a lower priority than the new message.
+    /// @return true if the message was queued, false if the queue is full.
+    bool push(const SDAMessage &message);
+
+    /// Add a message to the front of the queue, so it is served before other messages of the same priority.
+    /// Used to re-queue preempted messages.
+    /// @return true if the message was queued, false if the queue is full.
+    bool push_front(const SDAMessage &message);
+
+    /// Remove the highest priority message that is not expired from the queue. Expired messages are dropped.
+    /// @param now The current time, in millis().
+    /// @param message The message to write the result to.
+    /// @return true if a message was removed, false if the queue is empty.
+    bool pop(const uint32_t now, SDAMessage &message);
+
+    /// Remove all messages.
+    void clear()
+    {
+      this->count_ = 0;
+    }
+
+    /// Number of queued messages.
+    size_t size() const
+    {
+      return this->count_;
+    }
+
+  private:
+    std::array<SDAMessage, SDA5708_MESSAGE_QUEUE_SIZE> items_{};
+    size_t head_ = 0;
+    size_t count_ = 0;
+
+    SDAMessage &at(const size_t index)
+    {
+      return this->items_[(this->head_ + index) % this->items_.size()];
+    }
+
+    /// Remove the message at the given queue index, closing the gap.
+    void remove(const size_t index);
+
+    /// Drop the oldest lowest priority message, if its priority is lower than the given priority.
+    /// @return true if a message was dropped.
+    bool drop_lowest_below(const uint8_t priority);
+  };
+} // namespace esphome::sda5708
@@ -0,0 +1,71 @@
+#include "sda5708.h"
+
+#include <string>
+
+namespace esphome::sda5708
+{
+  /// Every nth delta publish is a full bitmap, so late subscribers catch up.
+  static constexpr uint8_t MIRROR_KEYFRAME_INTERVAL = 16;
+
+#pragma region Frame Mirror
+  void SDA5708Component::process_mirror(const uint32_t now)
+  {
+#ifdef USE_TEXT_SENSOR
+    if (this->mirror_sensor_ == nullptr)
+    {
+      this->mirror_pending_ = false;
+      return;
+    }
+
+    if (this->mirror_last_publish_ != 0 && now - this->mirror_last_publish_ < this->mirror_interval_)
+      return;
+
+    this->mirror_pending_ = false;
+
+    const uint8_t changed = this->screen_frame_.diff(this->mirror_frame_);
+    const bool keyframe = !this->mirror_delta_ || this->mirror_publish_count_ % MIRROR_KEYFRAME_INTERVAL == 0;
+    if (changed == 0 && !keyframe)
+      return;
+
+    // "F" + hex bitmap for full frames, "D" + hex digit mask and changed digit rows for deltas
+    uint8_t data[1 + SDAPackedFrame::BITMAP_SIZE];
+    size_t length = 0;
+    if (keyframe)
+    {
+      this->screen_frame_.to_bitmap(data);
+      length = SDAPackedFrame::BITMAP_SIZE;
+    }
+    else
+    {
+      data[length++] = changed;
+      for (uint8_t digit = 0; digit < SDAPackedFrame::DIGITS; digit++)
+      {
+        if ((changed & (1 << digit)) == 0)
+          continue;
+
+        for (uint8_t row = 0; row < SDAPackedFrame::ROWS; row++)
+          data[length++] = this->screen_frame_.get_digit_row(digit, row);
+      }
+    }
+
+    char text[1 + sizeof(data) * 2 + 1];
+    char *out = text;
+    *out++ = keyframe ? 'F' : 'D';
+    for (size_t i = 0; i < length; i++)
+    {
+      *out++ = format_hex_char(data[i] >> 4);
+      *out++ = format_hex_char(data[i] & 0x0F);
+    }
+    *out = '\0';
+
+    this->mirror_frame_ = this->screen_frame_;
+    this->mirror_last_publish_ = now;
+    this->mirror_publish_count_++;
+    this->mirror_sensor_->publish_state(std::string(text, out - text));
+#else
+    (void) now;
+    this->mirror_pending_ = false;
+#endif
+  }
+#pragma endregion
+} // namespace esphome::sda5708
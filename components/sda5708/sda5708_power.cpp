@@ -0,0 +1,98 @@
+#include "sda5708.h"
+
+#include "esphome/core/log.h"
+
+namespace esphome::sda5708
+{
+  static const char *const TAG = "sda5708.power";
+
+  /// LED duty cycle of each brightness level (0-7), from the datasheet.
+  static constexpr float BRIGHTNESS_DUTY[8] = {0.0f, 0.066f, 0.13f, 0.20f, 0.27f, 0.40f, 0.53f, 1.0f};
+
+  /// Peak current with `reduce_peak_current`, relative to the maximum peak current.
+  static constexpr float LOW_PEAK_CURRENT_FACTOR = 0.125f;
+
+  /// Minimum time between two publishes of the estimated current, in milliseconds.
+  static constexpr uint32_t CURRENT_PUBLISH_INTERVAL = 1000;
+
+#pragma region Power API
+  float SDA5708Component::get_estimated_current() const
+  {
+    return estimate_current(this->lit_pixels_, 7 - this->control_written_.m_nBR, this->control_written_.m_bIP);
+  }
+
+  float SDA5708Component::estimate_current(const uint16_t lit_pixels, const uint8_t brightness, const bool low_peak_current) const
+  {
+    float led_current = this->led_current_ * BRIGHTNESS_DUTY[brightness & 0b111];
+    if (low_peak_current)
+      led_current *= LOW_PEAK_CURRENT_FACTOR;
+
+    return this->base_current_ + lit_pixels * led_current;
+  }
+
+  void SDA5708Component::limit_current(SDAControlRegister &data) const
+  {
+    const uint8_t brightness = 7 - data.m_nBR;
+    if (brightness == 0 || estimate_current(this->lit_pixels_, brightness, data.m_bIP) <= this->max_current_)
+      return;
+
+    // prefer the brightest level within the budget, only reduce the peak current if dimming is not enough
+    for (const bool low_peak_current : {static_cast<bool>(data.m_bIP), true})
+    {
+      for (uint8_t level = brightness; level > 0; level--)
+      {
+        if (estimate_current(this->lit_pixels_, level, low_peak_current) <= this->max_current_)
+        {
+          data.m_nBR = 7 - level;
+          data.m_bIP = low_peak_current;
+          return;
+        }
+      }
+    }
+
+    // the budget cannot be met while showing anything, use the lowest setting
+    data.m_nBR = 6;
+    data.m_bIP = true;
+  }
+
+  void SDA5708Component::set_lit_pixels(const uint16_t lit_pixels)
+  {
+    if (lit_pixels == this->lit_pixels_)
+      return;
+
+    this->lit_pixels_ = lit_pixels;
+    if (this->max_current_ <= 0.0f)
+      return;
+
+    // only touch the control register if the limit changes
+    SDAControlRegister limited = this->control_register_;
+    limit_current(limited);
+    if (limited.m_nBR == this->control_written_.m_nBR && limited.m_bIP == this->control_written_.m_bIP)
+      return;
+
+    ESP_LOGV(TAG, "%u pixels lit, brightness %u, peak current %s", lit_pixels, 7 - limited.m_nBR,
+             limited.m_bIP ? "12.5%" : "maximum");
+    write_control_register(this->control_register_);
+  }
+
+  void SDA5708Component::process_power(const uint32_t now)
+  {
+#ifdef USE_SENSOR
+    if (this->current_sensor_ == nullptr)
+      return;
+
+    if (this->current_last_publish_ != 0 && now - this->current_last_publish_ < CURRENT_PUBLISH_INTERVAL)
+      return;
+
+    const float current = get_estimated_current();
+    if (this->current_sensor_->has_state() && this->current_sensor_->state == current)
+      return;
+
+    this->current_last_publish_ = now;
+    this->current_sensor_->publish_state(current);
+#else
+    (void) now;
+#endif
+  }
+#pragma endregion
+} // namespace esphome::sda5708
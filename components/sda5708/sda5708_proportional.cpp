@@ -0,0 +1,108 @@
+#include "sda5708.h"
+
+#ifdef USE_SDA5708_PROPORTIONAL
+#include "esphome/core/helpers.h"
+
+namespace esphome::sda5708
+{
+#pragma region Proportional Text Cache
+  const SDAProportionalText *SDAProportionalCache::find(const uint32_t key, const SDAFontBank *bank)
+  {
+    for (auto &entry : this->entries_)
+    {
+      if (entry.used && entry.key == key && entry.bank == bank)
+      {
+        entry.last_used = ++this->clock_;
+        return &entry.text;
+      }
+    }
+
+    return nullptr;
+  }
+
+  SDAProportionalText &SDAProportionalCache::put(const uint32_t key, const SDAFontBank *bank)
+  {
+    // use the first free or least recently used entry
+    size_t target = 0;
+    for (size_t i = 0; i < this->entries_.size(); i++)
+    {
+      const Entry &entry = this->entries_[i];
+      const Entry &current = this->entries_[target];
+      if (current.used && (!entry.used || entry.last_used < current.last_used))
+        target = i;
+    }
+
+    Entry &entry = this->entries_[target];
+    entry.key = key;
+    entry.bank = bank;
+    entry.used = true;
+    entry.last_used = ++this->clock_;
+    return entry.text;
+  }
+
+  void SDAProportionalCache::clear()
+  {
+    for (auto &entry : this->entries_)
+      entry.used = false;
+  }
+#pragma endregion
+
+#pragma region Proportional Layout
+  bool SDA5708Font::is_default_glyph(const char c, const SDAFontBank *bank) const
+  {
+    const uint8_t code = static_cast<uint8_t>(c);
+    if (code >= DEFAULT_FONT_INDEX.size() || DEFAULT_FONT_INDEX[code] == NO_GLYPH)
+      return false;
+
+    if (bank != nullptr && progmem_read_byte(bank->get_data() + code) != NO_GLYPH)
+      return false;
+
+#ifdef USE_SDA5708_CUSTOM_GLYPHS
+    if (this->user_glyphs_.find(c) != this->user_glyphs_.end())
+      return false;
+#endif
+
+    return true;
+  }
+
+  void SDA5708Font::layout_proportional(const char *text, const SDAFontBank *bank, const uint8_t max_columns, SDAProportionalText &result) const
+  {
+    constexpr uint8_t COLUMNS = SDAPackedFrame::COLUMNS;
+
+    result.frame.clear();
+    uint8_t column = 0;
+    for (; *text != '\0'; text++)
+    {
+      const auto glyph = get_glyph(*text, bank);
+      if (!glyph.has_value())
+        continue;
+
+      // built-in glyphs were measured at compile time, all others are measured here
+      const SDAGlyphSpan span = is_default_glyph(*text, bank)
+                                    ? DEFAULT_FONT_SPANS[DEFAULT_FONT_INDEX[static_cast<uint8_t>(*text)]]
+                                    : glyph_span(*glyph);
+      const uint8_t width = span.width != 0 ? span.width : SDAProportionalText::BLANK_WIDTH;
+
+      const uint8_t start = SDAProportionalText::place(column, width);
+      if (start + width > max_columns)
+        break;
+
+      if (span.width != 0)
+      {
+        const uint8_t shift = SDAPackedFrame::DIGIT_COLUMNS - span.first - span.width;
+        const uint8_t mask = (1 << span.width) - 1;
+        for (uint8_t row = 0; row < SDAPackedFrame::ROWS; row++)
+        {
+          const uint64_t bits = ((*glyph)[row] >> shift) & mask;
+          result.frame.set_row(row, result.frame.get_row(row) | (bits << (COLUMNS - start - width)));
+        }
+      }
+
+      column = start + width;
+    }
+
+    result.columns = column;
+  }
+#pragma endregion
+} // namespace esphome::sda5708
+#endif
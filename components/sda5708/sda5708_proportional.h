@@ -0,0 +1,79 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <array>
+
+#include "sda5708_font.h"
+#include "sda5708_frame.h"
+
+namespace esphome::sda5708
+{
+#ifndef SDA5708_PROPORTIONAL_CACHE_SIZE
+#define SDA5708_PROPORTIONAL_CACHE_SIZE 4
+#endif
+
+  /// Text laid out with proportional glyph widths, as a stream of pixel columns starting at column 0.
+  struct SDAProportionalText
+  {
+    /// Blank columns between two glyphs. Not added at digit boundaries, where the gap between the digits separates the glyphs.
+    static constexpr uint8_t GLYPH_SPACING = 1;
+    /// Width of blank glyphs (e.g. space), which have no lit columns to measure.
+    static constexpr uint8_t BLANK_WIDTH = 1;
+
+    /// Column a glyph of the given width starts at, following text that uses the columns before `column`.
+    /// Glyphs never span the gap between two digits, a glyph that does not fit into the rest of a digit starts at the next one.
+    static constexpr uint8_t place(const uint8_t column, const uint8_t width)
+    {
+      // the gap between two digits already separates glyphs
+      uint8_t start = column;
+      if (start % SDAPackedFrame::DIGIT_COLUMNS != 0)
+        start += GLYPH_SPACING;
+
+      const uint8_t digit_end = (start / SDAPackedFrame::DIGIT_COLUMNS + 1) * SDAPackedFrame::DIGIT_COLUMNS;
+      if (start + width > digit_end)
+        start = digit_end;
+      return start;
+    }
+
+    /// The laid out glyphs.
+    SDAPackedFrame frame;
+    /// Number of columns used, including the blank columns between glyphs.
+    uint8_t columns;
+  };
+
+  /// Fixed-capacity cache of laid out proportional texts, so unchanged texts are not laid out again on every update.
+  /// Texts are identified by a hash of the string and the font bank they were laid out with.
+  /// When all entries are in use, the least recently used entry is reused.
+  class SDAProportionalCache
+  {
+  public:
+    static constexpr size_t SIZE = SDA5708_PROPORTIONAL_CACHE_SIZE;
+
+    static_assert(SIZE > 0, "proportional text cache needs at least one entry");
+
+    /// Find the layout of a text, and mark it as used.
+    /// @return The layout, or nullptr if the text is not cached.
+    const SDAProportionalText *find(const uint32_t key, const SDAFontBank *bank);
+
+    /// Get the entry for a text, reusing the least recently used entry. The caller fills in the layout.
+    SDAProportionalText &put(const uint32_t key, const SDAFontBank *bank);
+
+    /// Remove all entries, e.g. after glyphs changed.
+    void clear();
+
+  private:
+    struct Entry
+    {
+      uint32_t key;
+      uint32_t last_used;
+      const SDAFontBank *bank;
+      SDAProportionalText text;
+      bool used;
+    };
+
+    std::array<Entry, SIZE> entries_{};
+
+    /// Incremented on each access, used to find the least recently used entry.
+    uint32_t clock_ = 0;
+  };
+} // namespace esphome::sda5708
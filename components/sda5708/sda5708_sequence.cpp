@@ -0,0 +1,155 @@
+#include "sda5708.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "esphome/core/log.h"
+
+namespace esphome::sda5708
+{
+  static const char *const TAG = "sda5708.sequence";
+
+#pragma region Sequence API
+  void SDA5708Component::run_sequence(const SDASequence *sequence)
+  {
+    if (sequence == nullptr || sequence->get_step_count() == 0)
+    {
+      stop_sequence();
+      return;
+    }
+
+    // a new sequence replaces the running one right away
+    ESP_LOGD(TAG, "Running sequence with %u steps", static_cast<unsigned>(sequence->get_step_count()));
+    this->sequence_ = sequence;
+    this->sequence_step_ = 0;
+    start_sequence_step(millis());
+  }
+
+  void SDA5708Component::stop_sequence()
+  {
+    if (this->sequence_ == nullptr)
+      return;
+
+    this->sequence_ = nullptr;
+
+    // fade steps do not change the brightness set by the user, return to it
+    if (this->sequence_faded_)
+    {
+      this->sequence_faded_ = false;
+      apply_brightness_target();
+    }
+
+    // bring back what the sequence covered, an animation continues with its next frame
+    if (this->message_active_)
+    {
+      render_message();
+      return;
+    }
+
+    // the base layer still holds the last normal content, loop() presents it and the next update renders it again
+    this->layers_dirty_ = true;
+    wake();
+  }
+
+  void SDA5708Component::start_sequence_step(const uint32_t now)
+  {
+    const SDASequenceStep &step = this->sequence_->get_step(this->sequence_step_);
+    this->sequence_step_start_ = now;
+    this->sequence_ticks_ = 0;
+    wake();
+
+    switch (step.type)
+    {
+    case SDASequenceStepType::SHOW:
+    case SDASequenceStepType::BLINK:
+      render_text(step.text, this->sequence_frame_);
+      write_frame(this->sequence_frame_);
+      break;
+
+    case SDASequenceStepType::SCROLL:
+      // the text scrolls in from the right
+      this->sequence_frame_.clear();
+      write_frame(this->sequence_frame_);
+      break;
+
+    case SDASequenceStepType::FADE:
+      start_fade(step.count, step.duration);
+      this->sequence_faded_ = true;
+      break;
+
+    case SDASequenceStepType::WAIT:
+      break;
+    }
+  }
+
+  void SDA5708Component::process_sequence(const uint32_t now)
+  {
+    const SDASequenceStep &step = this->sequence_->get_step(this->sequence_step_);
+    const uint32_t elapsed = now - this->sequence_step_start_;
+    bool done = elapsed >= step.duration;
+
+    if (step.type == SDASequenceStepType::BLINK)
+    {
+      // each blink is an on and an off phase
+      const uint32_t phase = elapsed / std::max<uint32_t>(step.duration / 2, 1);
+      done = phase >= step.count * 2u;
+      if (!done && phase != this->sequence_ticks_)
+      {
+        this->sequence_ticks_ = phase;
+        write_frame(phase % 2 == 0 ? this->sequence_frame_ : SDAPackedFrame());
+      }
+    }
+    else if (step.type == SDASequenceStepType::SCROLL)
+    {
+      // scroll until the text has left the screen on the left
+      const uint32_t length = strlen(step.text);
+      const uint32_t total = (length + SDAPackedFrame::DIGITS) * SDAPackedFrame::DIGIT_COLUMNS;
+      const uint32_t due = std::min<uint32_t>(elapsed / std::max<uint32_t>(step.duration, 1), total);
+
+      if (this->sequence_ticks_ < due)
+      {
+        while (this->sequence_ticks_ < due)
+        {
+          // shift in the next column of the text
+          const uint32_t column = this->sequence_ticks_++;
+          const uint32_t index = column / SDAPackedFrame::DIGIT_COLUMNS;
+
+          SDAPackedFrame fill;
+          if (index < length)
+          {
+            const char c[] = {step.text[index], '\0'};
+            render_text(c, fill);
+            fill.shift_left(column % SDAPackedFrame::DIGIT_COLUMNS);
+          }
+          this->sequence_frame_.shift_left(1, fill);
+        }
+        write_frame(this->sequence_frame_);
+      }
+
+      done = this->sequence_ticks_ >= total;
+    }
+
+    if (!done)
+      return;
+
+    if (++this->sequence_step_ >= this->sequence_->get_step_count())
+    {
+      ESP_LOGD(TAG, "Sequence finished");
+      stop_sequence();
+      return;
+    }
+
+    start_sequence_step(now);
+  }
+
+  void SDA5708Component::render_text(const char *text, SDAPackedFrame &frame) const
+  {
+    frame.clear();
+    for (uint8_t i = 0; i < SDAPackedFrame::DIGITS && text[i] != '\0'; i++)
+    {
+      if (const auto glyph = this->font_.get_glyph(text[i], this->font_bank_); glyph.has_value())
+        frame.set_glyph(i, glyph.value());
+    }
+  }
+#pragma endregion
+} // namespace esphome::sda5708
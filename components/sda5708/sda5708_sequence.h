@@ -0,0 +1,60 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace esphome::sda5708
+{
+  /// What a step of a sequence does.
+  enum class SDASequenceStepType : uint8_t
+  {
+    /// Show a text for `duration` milliseconds.
+    SHOW,
+    /// Scroll a text through the screen, one pixel column every `duration` milliseconds.
+    SCROLL,
+    /// Blink a text `count` times, with a period of `duration` milliseconds.
+    BLINK,
+    /// Fade the brightness to `count` (0-7) over `duration` milliseconds.
+    FADE,
+    /// Keep the screen as it is for `duration` milliseconds.
+    WAIT,
+  };
+
+  /// A single step of a sequence.
+  struct SDASequenceStep
+  {
+    SDASequenceStepType type;
+    /// Blink count or fade target brightness, see `SDASequenceStepType`.
+    uint8_t count;
+    /// Duration of the step, or the interval of scroll and blink steps, in milliseconds.
+    uint32_t duration;
+    /// Text of show, scroll and blink steps.
+    const char *text;
+  };
+
+  /// A list of steps (show, scroll, blink, fade and wait) played one after another, generated by codegen.
+  /// Sequences are run by the component's `loop()` without blocking, with timing independent of the update interval.
+  class SDASequence
+  {
+  public:
+    void add_step(const SDASequenceStepType type, const char *text, const uint32_t duration, const uint8_t count)
+    {
+      this->steps_.push_back({type, count, duration, text});
+    }
+
+    /// Get a step of the sequence.
+    const SDASequenceStep &get_step(const size_t index) const
+    {
+      return this->steps_[index];
+    }
+
+    /// Number of steps in the sequence.
+    size_t get_step_count() const
+    {
+      return this->steps_.size();
+    }
+
+  private:
+    std::vector<SDASequenceStep> steps_;
+  };
+} // namespace esphome::sda5708
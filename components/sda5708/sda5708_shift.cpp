@@ -0,0 +1,138 @@
+#include "sda5708.h"
+
+#ifdef USE_SDA5708_ISR_TRANSMIT
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+
+#ifdef USE_ESP8266
+#include <Arduino.h>
+#endif
+
+namespace esphome::sda5708
+{
+  static const char *const TAG = "sda5708.shift";
+
+#if defined(USE_ESP32)
+  /// Resolution of the transmit timer, in Hz.
+  static constexpr uint32_t SHIFT_TIMER_RESOLUTION = 10000000;
+
+  static bool IRAM_ATTR shift_timer_isr(gptimer_handle_t, const gptimer_alarm_event_data_t *, void *arg)
+  {
+    SDA5708Component::shift_tick(static_cast<SDA5708Component *>(arg));
+    return false;
+  }
+#elif defined(USE_ESP8266)
+  /// Clock of timer1 with TIM_DIV1, in Hz.
+  static constexpr uint32_t SHIFT_TIMER_RESOLUTION = 80000000;
+
+  /// timer1 interrupts take no argument, only a single screen can use interrupt transmit.
+  static SDA5708Component *shift_component = nullptr;
+
+  static void IRAM_ATTR shift_timer_isr()
+  {
+    SDA5708Component::shift_tick(shift_component);
+  }
+#endif
+
+#pragma region Interrupt Transmit
+  void SDA5708Component::setup_shift_timer()
+  {
+#if defined(USE_ESP32)
+    gptimer_config_t config{};
+    config.clk_src = GPTIMER_CLK_SRC_DEFAULT;
+    config.direction = GPTIMER_COUNT_UP;
+    config.resolution_hz = SHIFT_TIMER_RESOLUTION;
+
+    gptimer_alarm_config_t alarm{};
+    alarm.alarm_count = SHIFT_TIMER_RESOLUTION / this->shift_frequency_;
+    alarm.reload_count = 0;
+    alarm.flags.auto_reload_on_alarm = true;
+
+    gptimer_event_callbacks_t callbacks{};
+    callbacks.on_alarm = shift_timer_isr;
+
+    if (gptimer_new_timer(&config, &this->shift_timer_) != ESP_OK)
+    {
+      ESP_LOGW(TAG, "No timer available, using blocking transmit");
+      return;
+    }
+
+    if (gptimer_set_alarm_action(this->shift_timer_, &alarm) != ESP_OK ||
+        gptimer_register_event_callbacks(this->shift_timer_, &callbacks, this) != ESP_OK ||
+        gptimer_enable(this->shift_timer_) != ESP_OK)
+    {
+      ESP_LOGW(TAG, "Setting up the timer failed, using blocking transmit");
+      gptimer_del_timer(this->shift_timer_);
+      this->shift_timer_ = nullptr;
+      return;
+    }
+#elif defined(USE_ESP8266)
+    shift_component = this;
+    timer1_attachInterrupt(shift_timer_isr);
+#endif
+
+    this->shift_ready_ = true;
+  }
+
+  void SDA5708Component::queue_byte(const uint8_t data) const
+  {
+    // the queue holds more than a frame, so this only waits if frames are sent faster than the bus rate
+    while (!this->shift_queue_.push(data))
+    {
+    }
+
+    // the interrupt stops the timer once the queue is empty, so check and start it without being interrupted
+    InterruptLock lock;
+    if (!this->shift_active_)
+    {
+      this->shift_active_ = true;
+      start_shift_timer();
+    }
+  }
+
+  void SDA5708Component::wait_shift_idle() const
+  {
+    while (this->shift_active_)
+    {
+    }
+  }
+
+  void SDA5708Component::start_shift_timer() const
+  {
+#if defined(USE_ESP32)
+    gptimer_set_raw_count(this->shift_timer_, 0);
+    gptimer_start(this->shift_timer_);
+#elif defined(USE_ESP8266)
+    timer1_enable(TIM_DIV1, TIM_EDGE, TIM_LOOP);
+    timer1_write(SHIFT_TIMER_RESOLUTION / this->shift_frequency_);
+#endif
+  }
+
+  void IRAM_ATTR SDA5708Component::stop_shift_timer() const
+  {
+#if defined(USE_ESP32)
+    gptimer_stop(this->shift_timer_);
+#elif defined(USE_ESP8266)
+    timer1_disable();
+#endif
+  }
+
+  void IRAM_ATTR SDA5708Component::shift_tick(SDA5708Component *component)
+  {
+    if (!component->shifter_.tick(component->shift_queue_))
+    {
+      // nothing left to send, the next queued byte starts the timer again
+      component->shift_active_ = false;
+      component->stop_shift_timer();
+      return;
+    }
+
+    // clock before data, so data never changes while the clock is high
+    const SDABusLevels &levels = component->shifter_.get_levels();
+    component->fast_clock_pin_.write(levels.clock);
+    component->fast_data_pin_.write(levels.data);
+    component->fast_load_pin_.write(levels.load);
+  }
+#pragma endregion
+} // namespace esphome::sda5708
+#endif
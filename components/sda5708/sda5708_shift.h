@@ -0,0 +1,148 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <array>
+#include <atomic>
+
+namespace esphome::sda5708
+{
+#ifndef SDA5708_SHIFT_QUEUE_SIZE
+#define SDA5708_SHIFT_QUEUE_SIZE 128
+#endif
+
+  /// Queue of bytes waiting to be shifted out on the bus. Filled by the main loop, drained by the transmit interrupt.
+  /// Lock-free for a single producer and a single consumer.
+  class SDAShiftQueue
+  {
+  public:
+    static constexpr size_t SIZE = SDA5708_SHIFT_QUEUE_SIZE;
+
+    static_assert(SIZE >= 2 && SIZE <= 32768 && (SIZE & (SIZE - 1)) == 0, "shift queue size must be a power of two");
+
+    /// Add a byte to the queue (producer side).
+    /// @return false if the queue is full.
+    bool push(const uint8_t data)
+    {
+      const uint16_t head = this->head_.load(std::memory_order_relaxed);
+      if (static_cast<uint16_t>(head - this->tail_.load(std::memory_order_acquire)) >= SIZE)
+        return false;
+
+      this->data_[head % SIZE] = data;
+      this->head_.store(head + 1, std::memory_order_release);
+      return true;
+    }
+
+    /// Take the oldest byte from the queue (consumer side).
+    /// @return false if the queue is empty.
+    inline __attribute__((always_inline)) bool pop(uint8_t &data)
+    {
+      const uint16_t tail = this->tail_.load(std::memory_order_relaxed);
+      if (tail == this->head_.load(std::memory_order_acquire))
+        return false;
+
+      data = this->data_[tail % SIZE];
+      this->tail_.store(tail + 1, std::memory_order_release);
+      return true;
+    }
+
+    bool empty() const
+    {
+      return this->head_.load(std::memory_order_acquire) == this->tail_.load(std::memory_order_acquire);
+    }
+
+  private:
+    std::array<uint8_t, SIZE> data_{};
+
+    /// Free running counters, wrapping at 2^16. Their difference is the number of queued bytes.
+    std::atomic<uint16_t> head_{0};
+    std::atomic<uint16_t> tail_{0};
+  };
+
+  /// Levels of the bus pins.
+  struct SDABusLevels
+  {
+    bool data = false;
+    bool clock = false;
+    /// Active low, high while no byte is transferred.
+    bool load = true;
+  };
+
+  /// State machine shifting queued bytes out on the bus, one step per timer tick.
+  /// The screen takes over data on the rising clock edge, so each bit takes two ticks (clock high, clock low and next data bit).
+  /// A byte takes `TICKS_PER_BYTE` ticks: #LOAD low with the first data bit, 8 clock pulses, and #LOAD high.
+  class SDAShifter
+  {
+  public:
+    static constexpr uint8_t TICKS_PER_BYTE = 1 + 8 * 2 + 1;
+
+    /// Advance the bus by one tick. The caller writes the levels to the pins afterwards.
+    /// @return false if the bus is idle and the queue is empty, i.e. the timer can be stopped. The levels are unchanged.
+    inline __attribute__((always_inline)) bool tick(SDAShiftQueue &queue)
+    {
+      switch (this->state_)
+      {
+      case State::IDLE:
+        if (!queue.pop(this->byte_))
+          return false;
+
+        // #LOAD low to start the transfer, with the first data bit, LSB first
+        this->bit_ = 0;
+        this->levels_.load = false;
+        this->levels_.data = (this->byte_ & 0x01) != 0;
+        this->state_ = State::CLOCK_HIGH;
+        return true;
+
+      case State::CLOCK_HIGH:
+        this->levels_.clock = true;
+        this->state_ = State::CLOCK_LOW;
+        return true;
+
+      case State::CLOCK_LOW:
+        this->levels_.clock = false;
+        if (++this->bit_ < 8)
+        {
+          this->levels_.data = ((this->byte_ >> this->bit_) & 0x01) != 0;
+          this->state_ = State::CLOCK_HIGH;
+        }
+        else
+        {
+          this->state_ = State::LOAD_HIGH;
+        }
+        return true;
+
+      case State::LOAD_HIGH:
+      default:
+        // #LOAD high to end the transfer, the screen processes the byte until the next tick
+        this->levels_.load = true;
+        this->state_ = State::IDLE;
+        return true;
+      }
+    }
+
+    /// Levels of the pins after the last tick.
+    const SDABusLevels &get_levels() const
+    {
+      return this->levels_;
+    }
+
+    /// Is a byte being shifted out?
+    bool is_busy() const
+    {
+      return this->state_ != State::IDLE;
+    }
+
+  private:
+    enum class State : uint8_t
+    {
+      IDLE,
+      CLOCK_HIGH,
+      CLOCK_LOW,
+      LOAD_HIGH,
+    };
+
+    State state_ = State::IDLE;
+    SDABusLevels levels_{};
+    uint8_t byte_ = 0;
+    uint8_t bit_ = 0;
+  };
+} // namespace esphome::sda5708
@@ -0,0 +1,140 @@
+#include "sda5708_stream.h"
+
+namespace esphome::sda5708
+{
+  SDAStreamParser::Result SDAStreamParser::feed(const uint8_t byte, SDAPackedFrame &back)
+  {
+    switch (this->state_)
+    {
+    case State::SYNC:
+      if (byte == SYNC)
+        this->state_ = State::TYPE;
+      return Result::NONE;
+
+    case State::TYPE:
+      this->type_ = static_cast<PacketType>(byte);
+      this->checksum_ = byte;
+      switch (this->type_)
+      {
+      case PacketType::FRAME:
+        this->length_ = SDAPackedFrame::BITMAP_SIZE;
+        break;
+      case PacketType::DELTA:
+        this->length_ = 1; // extended once the digit mask is known
+        break;
+      case PacketType::CONTROL:
+        this->length_ = 1;
+        break;
+      default:
+        // unknown type, probably not a real sync byte
+        this->dropped_++;
+        this->state_ = byte == SYNC ? State::TYPE : State::SYNC;
+        return Result::NONE;
+      }
+      this->state_ = State::SEQ;
+      return Result::NONE;
+
+    case State::SEQ:
+      this->seq_ = byte;
+      this->checksum_ += byte;
+      this->received_ = 0;
+      this->row_ = 0;
+      this->state_ = State::PAYLOAD;
+      return Result::NONE;
+
+    case State::PAYLOAD:
+      this->checksum_ += byte;
+      feed_payload(byte, back);
+      if (++this->received_ >= this->length_)
+        this->state_ = State::CHECKSUM;
+      return Result::NONE;
+
+    case State::CHECKSUM:
+    default:
+      this->state_ = State::SYNC;
+      if (byte != this->checksum_)
+      {
+        this->dropped_++;
+        return this->type_ == PacketType::CONTROL ? Result::NONE : Result::DISCARDED;
+      }
+
+      if (!check_sequence())
+      {
+        this->late_++;
+        return this->type_ == PacketType::CONTROL ? Result::NONE : Result::DISCARDED;
+      }
+
+      if (this->type_ == PacketType::CONTROL)
+        return Result::CONTROL;
+
+      this->frames_++;
+      return Result::FRAME;
+    }
+  }
+
+  void SDAStreamParser::feed_payload(const uint8_t byte, SDAPackedFrame &back)
+  {
+    switch (this->type_)
+    {
+    case PacketType::FRAME:
+    {
+      // assemble rows byte by byte, MSB first
+      this->row_ = (this->row_ << 8) | byte;
+      if ((this->received_ + 1) % SDAPackedFrame::BITMAP_ROW_BYTES == 0)
+      {
+        back.set_row(this->received_ / SDAPackedFrame::BITMAP_ROW_BYTES, this->row_);
+        this->row_ = 0;
+      }
+      break;
+    }
+
+    case PacketType::DELTA:
+    {
+      if (this->received_ == 0)
+      {
+        // digit mask determines the payload length
+        this->delta_digits_ = byte;
+        this->delta_digit_ = 0;
+        this->length_ = 1 + __builtin_popcount(byte) * SDAPackedFrame::ROWS;
+        break;
+      }
+
+      const uint8_t index = this->received_ - 1;
+      const uint8_t row = index % SDAPackedFrame::ROWS;
+      if (row == 0)
+      {
+        // advance to the next changed digit
+        while (this->delta_digit_ < SDAPackedFrame::DIGITS && (this->delta_digits_ & (1 << this->delta_digit_)) == 0)
+          this->delta_digit_++;
+      }
+
+      back.set_digit_row(this->delta_digit_, row, byte);
+      if (row == SDAPackedFrame::ROWS - 1)
+        this->delta_digit_++;
+      break;
+    }
+
+    case PacketType::CONTROL:
+      this->control_ = byte;
+      break;
+    }
+  }
+
+  bool SDAStreamParser::check_sequence()
+  {
+    if (!this->has_seq_)
+    {
+      this->has_seq_ = true;
+      this->last_seq_ = this->seq_;
+      return true;
+    }
+
+    const int8_t distance = static_cast<int8_t>(this->seq_ - this->last_seq_);
+    if (distance <= 0)
+      return false;
+
+    this->dropped_ += distance - 1;
+    this->last_seq_ = this->seq_;
+    return true;
+  }
+} // namespace esphome::sda5708
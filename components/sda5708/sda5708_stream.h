@@ -0,0 +1,136 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+#include "sda5708_frame.h"
+
+namespace esphome::sda5708
+{
+  /// Incremental parser for the binary frame stream protocol.
+  ///
+  /// Every packet has the following layout:
+  ///   0xA5 | type | seq | payload | checksum
+  /// - type: packet type, see `PacketType`.
+  /// - seq: sequence number, incremented by one for every packet (wrapping at 255).
+  /// - checksum: sum of type, seq and all payload bytes, modulo 256.
+  ///
+  /// Payloads:
+  /// - FRAME (0x01): 35 bytes, the 7 rows of the screen with 5 bytes each.
+  ///   Every row holds the 40 columns MSB first, the leftmost column is the MSB of the first byte.
+  /// - DELTA (0x02): one byte mask of changed digits (bit 0: digit 0), followed by 7 row bytes for each changed digit,
+  ///   in ascending digit order. This is the same format as delta-encoded animation frames.
+  /// - CONTROL (0x03): one byte: bits 0-2 brightness (0-7, 7: 100%), bit 3 reduced peak current, bit 4 clear screen.
+  ///
+  /// Frame data is written into the given back frame while it is received, without buffering the packet.
+  /// If a packet turns out to be corrupt, the back frame has to be restored by the caller.
+  class SDAStreamParser
+  {
+  public:
+    static constexpr uint8_t SYNC = 0xA5;
+
+    enum class PacketType : uint8_t
+    {
+      FRAME = 0x01,
+      DELTA = 0x02,
+      CONTROL = 0x03,
+    };
+
+    enum class Result : uint8_t
+    {
+      /// Packet incomplete, nothing to do.
+      NONE,
+      /// A complete frame (or delta) was received into the back frame.
+      FRAME,
+      /// A control byte was received, see `get_control()`.
+      CONTROL,
+      /// A corrupt or late packet was discarded after modifying the back frame.
+      DISCARDED,
+    };
+
+    /// Control byte flags.
+    static constexpr uint8_t CONTROL_BRIGHTNESS_MASK = 0b00000111;
+    static constexpr uint8_t CONTROL_LOW_PEAK_CURRENT = 0b00001000;
+    static constexpr uint8_t CONTROL_CLEAR = 0b00010000;
+
+    /// Feed a single byte into the parser.
+    /// @param byte The received byte.
+    /// @param back The frame to write received frame data to.
+    /// @return What to do after this byte.
+    Result feed(const uint8_t byte, SDAPackedFrame &back);
+
+    /// Get the payload of the last CONTROL packet.
+    uint8_t get_control() const
+    {
+      return this->control_;
+    }
+
+    /// Number of frames (full and delta) received successfully.
+    uint32_t get_frame_count() const
+    {
+      return this->frames_;
+    }
+
+    /// Number of packets lost, either corrupt or missing according to the sequence number.
+    uint32_t get_dropped_count() const
+    {
+      return this->dropped_;
+    }
+
+    /// Number of packets received out of order (older than the last accepted packet) and discarded.
+    uint32_t get_late_count() const
+    {
+      return this->late_;
+    }
+
+    /// Reset the parser state, e.g. after the connection was lost. Counters are kept.
+    /// @return true if a frame or delta packet was cut off, which may have modified the back frame like a DISCARDED packet.
+    bool reset()
+    {
+      const bool cut_off =
+          (this->state_ == State::PAYLOAD || this->state_ == State::CHECKSUM) && this->type_ != PacketType::CONTROL;
+      this->state_ = State::SYNC;
+      this->has_seq_ = false;
+      return cut_off;
+    }
+
+  private:
+    enum class State : uint8_t
+    {
+      SYNC,
+      TYPE,
+      SEQ,
+      PAYLOAD,
+      CHECKSUM,
+    };
+
+    State state_ = State::SYNC;
+    PacketType type_ = PacketType::FRAME;
+    uint8_t seq_ = 0;
+    uint8_t checksum_ = 0;
+
+    /// Payload bytes received of the current packet, and expected payload length.
+    uint8_t received_ = 0;
+    uint8_t length_ = 0;
+
+    /// Partially received row (FRAME) or changed digit mask (DELTA).
+    uint64_t row_ = 0;
+    uint8_t delta_digits_ = 0;
+    uint8_t delta_digit_ = 0;
+
+    uint8_t control_ = 0;
+
+    bool has_seq_ = false;
+    uint8_t last_seq_ = 0;
+
+    uint32_t frames_ = 0;
+    uint32_t dropped_ = 0;
+    uint32_t late_ = 0;
+
+    /// Handle a payload byte, writing frame data to the back frame.
+    void feed_payload(const uint8_t byte, SDAPackedFrame &back);
+
+    /// Check the sequence number of a complete packet.
+    /// @return true if the packet is current, false if it is late.
+    bool check_sequence();
+  };
+} // namespace esphome::sda5708
@@ -0,0 +1,83 @@
+#include "sda5708.h"
+
+#ifdef USE_SDA5708_SYNC
+#include <cinttypes>
+#include <sys/time.h>
+
+#include "esphome/core/log.h"
+
+namespace esphome::sda5708
+{
+  static const char *const TAG = "sda5708.sync";
+
+  /// Time before a presentation time from which the loop busy-waits for it, in microseconds.
+  /// The high frequency loop gets close, the busy-wait makes the latch independent of other components.
+  static constexpr int64_t SYNC_SPIN_US = 2000;
+
+#pragma region Sync API
+  int64_t SDA5708Component::sync_clock()
+  {
+    struct timeval tv;
+    gettimeofday(&tv, nullptr);
+    return static_cast<int64_t>(tv.tv_sec) * 1000000 + tv.tv_usec;
+  }
+
+  void SDA5708Component::schedule_sync(const int64_t time)
+  {
+    // presentation times are multiples of the interval, so all screens with the same interval share them
+    const int64_t interval = static_cast<int64_t>(this->sync_interval_) * 1000;
+    this->sync_next_ = (time / interval + 1) * interval;
+    this->sync_rendered_ = false;
+
+#ifdef USE_TIME
+    if (this->layout_ != nullptr)
+      this->layout_->set_time(this->sync_next_ / 1000000);
+#endif
+  }
+
+  void SDA5708Component::process_sync()
+  {
+    int64_t time = sync_clock();
+
+    // not scheduled yet, or the clock was stepped (e.g. on the first time sync)
+    const int64_t interval = static_cast<int64_t>(this->sync_interval_) * 1000;
+    if (this->sync_next_ == 0 || time - this->sync_next_ > interval || this->sync_next_ - time > interval)
+    {
+      ESP_LOGV(TAG, "Clock changed, rescheduling");
+      schedule_sync(time);
+    }
+
+    // render the content for the next presentation time, the frame is buffered by write_frame()
+    if (!this->sync_rendered_)
+    {
+      if (time < this->sync_next_ - static_cast<int64_t>(this->sync_lead_) * 1000)
+        return;
+
+      this->sync_rendered_ = true;
+      this->sync_loop_requester_.start();
+      update();
+      time = sync_clock();
+    }
+
+    if (this->sync_next_ - time > SYNC_SPIN_US)
+      return;
+
+    while (time < this->sync_next_)
+      time = sync_clock();
+
+    if (this->sync_pending_)
+    {
+      this->sync_pending_ = false;
+      this->sync_direct_ = true;
+      write_frame(this->sync_frame_);
+      this->sync_direct_ = false;
+    }
+
+    ESP_LOGV(TAG, "Presented at %" PRId64 ", %" PRId64 " us late", this->sync_next_, time - this->sync_next_);
+
+    this->sync_loop_requester_.stop();
+    schedule_sync(time);
+  }
+#pragma endregion
+} // namespace esphome::sda5708
+#endif
@@ -0,0 +1,49 @@
+#include "sda5708.h"
+
+#include "esphome/core/log.h"
+
+namespace esphome::sda5708
+{
+  static const char *const TAG = "sda5708.trace";
+
+#pragma region Bus Trace API
+#ifdef USE_SDA5708_BUS_TRACE
+  /// Number of records logged per line, keeps lines well below the log buffer size.
+  static constexpr uint8_t TRACE_RECORDS_PER_LINE = 8;
+
+  void SDA5708Component::dump_bus_trace()
+  {
+    const SDABusTrace &trace = this->bus_trace_;
+    const size_t count = trace.size();
+
+    ESP_LOGI(TAG, "TRACE BEGIN %u", static_cast<unsigned>(count));
+
+    char line[TRACE_RECORDS_PER_LINE * SDABusTrace::RECORD_SIZE * 2 + 1];
+    for (size_t start = 0; start < count; start += TRACE_RECORDS_PER_LINE)
+    {
+      char *out = line;
+      for (size_t index = start; index < count && index < start + TRACE_RECORDS_PER_LINE; index++)
+      {
+        uint8_t record[SDABusTrace::RECORD_SIZE];
+        trace.encode(index, record);
+        for (const uint8_t byte : record)
+        {
+          *out++ = format_hex_char(byte >> 4);
+          *out++ = format_hex_char(byte & 0x0F);
+        }
+      }
+      *out = '\0';
+
+      ESP_LOGI(TAG, "TRACE %04X %s", static_cast<unsigned>(start), line);
+    }
+
+    ESP_LOGI(TAG, "TRACE END");
+  }
+#else
+  void SDA5708Component::dump_bus_trace()
+  {
+    ESP_LOGW(TAG, "Bus trace is not enabled, set bus_trace in the configuration");
+  }
+#endif
+#pragma endregion
+} // namespace esphome::sda5708
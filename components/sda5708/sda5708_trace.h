@@ -0,0 +1,99 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <array>
+
+namespace esphome::sda5708
+{
+#ifndef SDA5708_BUS_TRACE_SIZE
+#define SDA5708_BUS_TRACE_SIZE 256
+#endif
+
+  /// A single operation on the screen bus.
+  struct SDABusTraceEntry
+  {
+    /// Time of the operation, in micros().
+    uint32_t time;
+
+    /// The byte that was sent. The register it was sent to follows from its upper bits
+    /// (control: 0b11xxxxxx, address: 0b101xxxxx, column data: 0b000xxxxx).
+    uint8_t data;
+
+    /// Operation flags, see `FLAG_*`.
+    uint8_t flags;
+
+    /// The screen was reset via the reset pin (`data` is unused).
+    static constexpr uint8_t FLAG_RESET = 0x01;
+  };
+
+  /// Fixed-size ring buffer of the last bus operations, for post-mortem analysis of what was sent to the screen.
+  /// Recording is a single store, so it can stay enabled in the field.
+  class SDABusTrace
+  {
+  public:
+    static constexpr size_t SIZE = SDA5708_BUS_TRACE_SIZE;
+
+    // indexes wrap with a mask instead of a division
+    static_assert(SIZE > 0 && (SIZE & (SIZE - 1)) == 0, "bus trace size must be a power of two");
+
+    /// Size of a dumped entry: time (4 bytes, big endian), flags and data.
+    static constexpr size_t RECORD_SIZE = 6;
+
+    /// Record a byte sent to the screen.
+    void record(const uint32_t time, const uint8_t data)
+    {
+      this->push({time, data, 0});
+    }
+
+    /// Record a reset of the screen.
+    void record_reset(const uint32_t time)
+    {
+      this->push({time, 0, SDABusTraceEntry::FLAG_RESET});
+    }
+
+    /// Number of recorded entries.
+    size_t size() const
+    {
+      return this->count_;
+    }
+
+    /// Get a recorded entry, 0 being the oldest one.
+    const SDABusTraceEntry &at(const size_t index) const
+    {
+      return this->entries_[(this->head_ - this->count_ + index) & (SIZE - 1)];
+    }
+
+    /// Write a recorded entry in its dump format (`RECORD_SIZE` bytes).
+    void encode(const size_t index, uint8_t *record) const
+    {
+      const SDABusTraceEntry &entry = this->at(index);
+      record[0] = entry.time >> 24;
+      record[1] = entry.time >> 16;
+      record[2] = entry.time >> 8;
+      record[3] = entry.time;
+      record[4] = entry.flags;
+      record[5] = entry.data;
+    }
+
+    /// Remove all entries.
+    void clear()
+    {
+      this->count_ = 0;
+    }
+
+  private:
+    std::array<SDABusTraceEntry, SIZE> entries_{};
+
+    /// Index the next entry is written to.
+    size_t head_ = 0;
+    size_t count_ = 0;
+
+    void push(const SDABusTraceEntry &entry)
+    {
+      this->entries_[this->head_] = entry;
+      this->head_ = (this->head_ + 1) & (SIZE - 1);
+      if (this->count_ < SIZE)
+        this->count_++;
+    }
+  };
+} // namespace esphome::sda5708
@@ -0,0 +1,135 @@
+#include "sda5708.h"
+
+#ifdef USE_SDA5708_VIRTUAL_SCREEN
+#include <cstdio>
+
+#include "esphome/core/log.h"
+
+namespace esphome::sda5708
+{
+  static const char *const TAG = "sda5708.virtual";
+
+#pragma region Virtual Screen
+  void SDAVirtualScreen::write(const uint8_t data)
+  {
+    if ((data & 0b11000000) == 0b11000000)
+    {
+      // control register: CLR (active low) on D5, IP on D4, BR on D2-D0
+      const uint8_t brightness = 7 - (data & 0b111);
+      const bool low_peak_current = (data & (1 << 4)) != 0;
+      if ((data & (1 << 5)) == 0 && this->frame_ != SDAPackedFrame())
+      {
+        this->frame_.clear();
+        this->changed_ = true;
+      }
+      if (brightness != this->brightness_ || low_peak_current != this->low_peak_current_)
+      {
+        this->brightness_ = brightness;
+        this->low_peak_current_ = low_peak_current;
+        this->changed_ = true;
+      }
+    }
+    else if ((data & 0b11100000) == 0b10100000)
+    {
+      // address register: digit on D2-D0, column data starts at the top row
+      this->digit_ = data & 0b111;
+      this->row_ = 0;
+    }
+    else if ((data & 0b11100000) == 0 && this->row_ < SDAPackedFrame::ROWS)
+    {
+      // column data: one row of the selected digit
+      const uint8_t bits = data & 0b11111;
+      if (this->frame_.get_digit_row(this->digit_, this->row_) != bits)
+      {
+        this->frame_.set_digit_row(this->digit_, this->row_, bits);
+        this->changed_ = true;
+      }
+      this->row_++;
+    }
+  }
+
+  void SDAVirtualScreen::reset()
+  {
+    this->frame_.clear();
+    this->digit_ = 0;
+    this->row_ = 0;
+    this->brightness_ = 0;
+    this->low_peak_current_ = false;
+    this->changed_ = true;
+  }
+
+  std::string SDAVirtualScreen::render(const bool rotated) const
+  {
+    constexpr uint8_t COLUMNS = SDAPackedFrame::COLUMNS;
+
+    SDAPackedFrame frame = this->frame_;
+    if (rotated)
+      frame.mirror();
+
+    char status[64];
+    snprintf(status, sizeof(status), "SDA5708 brightness %u/7, peak current %s\n", this->brightness_,
+             this->low_peak_current_ ? "12.5%" : "maximum");
+
+    std::string text = status;
+    for (uint8_t row = 0; row < SDAPackedFrame::ROWS; row++)
+    {
+      const uint64_t bits = frame.get_row(row);
+
+      text += '|';
+      for (uint8_t column = 0; column < COLUMNS; column++)
+      {
+        text += (bits & (uint64_t(1) << (COLUMNS - 1 - column))) != 0 ? '#' : '.';
+        if (column % SDAPackedFrame::DIGIT_COLUMNS == SDAPackedFrame::DIGIT_COLUMNS - 1)
+          text += '|';
+      }
+      text += '\n';
+    }
+
+    return text;
+  }
+#pragma endregion
+
+#pragma region Virtual Screen API
+  void SDA5708Component::process_virtual_screen(const uint32_t now)
+  {
+    if (!this->virtual_screen_.has_changed())
+      return;
+
+    if (this->virtual_screen_last_output_ != 0 && now - this->virtual_screen_last_output_ < this->virtual_screen_interval_)
+      return;
+
+    this->virtual_screen_last_output_ = now;
+    this->virtual_screen_.clear_changed();
+
+#ifdef USE_SDA5708_ROTATION
+    const std::string text = this->virtual_screen_.render(this->rotate_screen_);
+#else
+    const std::string text = this->virtual_screen_.render(false);
+#endif
+
+    if (this->virtual_screen_file_.empty())
+    {
+      fputs("\n", stdout);
+      fputs(text.c_str(), stdout);
+      fflush(stdout);
+      return;
+    }
+
+    // write a temporary file and move it in place, so readers never see a partial screen
+    const std::string temp_file = this->virtual_screen_file_ + ".tmp";
+    FILE *file = fopen(temp_file.c_str(), "w");
+    if (file == nullptr)
+    {
+      ESP_LOGW(TAG, "Cannot open %s", temp_file.c_str());
+      return;
+    }
+
+    fputs(text.c_str(), file);
+    fclose(file);
+
+    if (rename(temp_file.c_str(), this->virtual_screen_file_.c_str()) != 0)
+      ESP_LOGW(TAG, "Cannot write %s", this->virtual_screen_file_.c_str());
+  }
+#pragma endregion
+} // namespace esphome::sda5708
+#endif
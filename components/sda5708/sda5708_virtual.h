@@ -0,0 +1,64 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+#include "sda5708_frame.h"
+
+namespace esphome::sda5708
+{
+  /// Emulation of the screen controller, for builds without a screen attached (e.g. ESPHome's `host` platform).
+  /// Decodes the bytes sent on the bus like the SDA5708 does, so everything above the bus runs unchanged.
+  class SDAVirtualScreen
+  {
+  public:
+    /// Decode a byte sent to the screen.
+    void write(const uint8_t data);
+
+    /// Reset the screen, like a pulse on the reset pin does.
+    void reset();
+
+    /// Render the screen as text: a status line, followed by one line per pixel row ('#': lit, '.': dark).
+    /// @param rotated Render the screen rotated by 180 degrees, as it is mounted with `rotate_screen`.
+    std::string render(const bool rotated) const;
+
+    /// Pixels currently shown, as the screen is wired (physical digit 0 is the leftmost digit).
+    const SDAPackedFrame &get_frame() const
+    {
+      return this->frame_;
+    }
+
+    /// Brightness currently set, 0 (off) to 7 (full).
+    uint8_t get_brightness() const
+    {
+      return this->brightness_;
+    }
+
+    /// Is the peak current reduced to 12.5%?
+    bool is_low_peak_current() const
+    {
+      return this->low_peak_current_;
+    }
+
+    /// Did pixels or the control register change since the last call to `clear_changed()`?
+    bool has_changed() const
+    {
+      return this->changed_;
+    }
+
+    void clear_changed()
+    {
+      this->changed_ = false;
+    }
+
+  private:
+    SDAPackedFrame frame_{};
+
+    /// Digit selected by the last address byte, and row the next column data byte is written to.
+    uint8_t digit_ = 0;
+    uint8_t row_ = 0;
+
+    uint8_t brightness_ = 0;
+    bool low_peak_current_ = false;
+    bool changed_ = true;
+  };
+} // namespace esphome::sda5708
@@ -0,0 +1,3 @@
+#pragma once
+// Stand-in for the defines generated by an ESPHome build, so the host tools can include the component headers.
+#define USE_SDA5708_FULL_FONT
@@ -0,0 +1,85 @@
+// Check the placement of proportional glyphs on the host.
+//
+// Glyphs are placed with SDAProportionalText::place() and the built-in glyph widths, like layout_proportional() does.
+// Every glyph has to stay within a single digit, as the gap between two digits would split it.
+//
+// Example (from the repository root):
+//   g++ -std=c++17 -Wall -Wno-unknown-pragmas -I components/sda5708 -I tools/host -o /tmp/sda5708_proportional_test tools/sda5708_proportional_test.cpp && /tmp/sda5708_proportional_test
+#include <cstdio>
+
+#include "sda5708_proportional.h"
+
+using esphome::sda5708::DEFAULT_FONT_INDEX;
+using esphome::sda5708::DEFAULT_FONT_SPANS;
+using esphome::sda5708::SDAPackedFrame;
+using esphome::sda5708::SDAProportionalText;
+
+static constexpr uint8_t DIGIT_COLUMNS = SDAPackedFrame::DIGIT_COLUMNS;
+
+static int failures = 0;
+
+static void check(const bool condition, const char *message, const char *text, const uint8_t column)
+{
+  if (condition)
+    return;
+
+  printf("FAIL \"%s\" at column %u: %s\n", text, column, message);
+  failures++;
+}
+
+static uint8_t glyph_width(const char c)
+{
+  const uint8_t width = DEFAULT_FONT_SPANS[DEFAULT_FONT_INDEX[static_cast<uint8_t>(c)]].width;
+  return width != 0 ? width : SDAProportionalText::BLANK_WIDTH;
+}
+
+/// Place the glyphs of a text and check that none of them crosses a digit boundary.
+/// @return The start column of the glyph at `index`.
+static uint8_t layout(const char *text, const size_t index)
+{
+  uint8_t column = 0;
+  uint8_t result = 0;
+  for (size_t i = 0; text[i] != '\0'; i++)
+  {
+    const uint8_t width = glyph_width(text[i]);
+    const uint8_t start = SDAProportionalText::place(column, width);
+    if (start + width > SDAPackedFrame::COLUMNS)
+      break;
+
+    check(start >= column, "glyph overlaps the previous glyph", text, start);
+    check(start / DIGIT_COLUMNS == (start + width - 1) / DIGIT_COLUMNS, "glyph crosses a digit boundary", text, start);
+    if (i == index)
+      result = start;
+    column = start + width;
+  }
+  return result;
+}
+
+int main()
+{
+  // "2" and "3" fill a digit each, "." takes one column of the third digit, "5" does not fit behind it
+  const uint8_t five = layout("23.5", 3);
+  check(five == 3 * DIGIT_COLUMNS, "\"5\" does not start at the fourth digit", "23.5", five);
+
+  // narrow glyphs still share a digit, with a blank column between them
+  const uint8_t colon = layout("1:1", 1);
+  check(colon == glyph_width('1') + SDAProportionalText::GLYPH_SPACING, "\":\" does not follow \"1\"", "1:1", colon);
+
+  layout("23.5 C 45%", 0);
+  layout("12:34:56", 0);
+  layout("1.1.1.1.1.1.1.1", 0);
+
+  // every width after every column
+  for (uint8_t column = 0; column < SDAPackedFrame::COLUMNS; column++)
+  {
+    for (uint8_t width = 1; width <= DIGIT_COLUMNS; width++)
+    {
+      const uint8_t start = SDAProportionalText::place(column, width);
+      check(start >= column, "glyph overlaps the previous glyph", "place()", column);
+      check(start / DIGIT_COLUMNS == (start + width - 1) / DIGIT_COLUMNS, "glyph crosses a digit boundary", "place()", column);
+    }
+  }
+
+  printf("%s\n", failures == 0 ? "OK" : "FAILED");
+  return failures == 0 ? 0 : 1;
+}
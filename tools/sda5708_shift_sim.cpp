@@ -0,0 +1,129 @@
+// Drive the interrupt transmit state machine on the host and check the bus levels it produces.
+//
+// A simulated timer calls SDAShifter::tick() like the transmit interrupt does. Bytes are decoded from the levels the
+// way the screen reads them (data taken over on the rising clock edge while #LOAD is low, the byte is complete when
+// #LOAD goes high), and checked for LSB first bit order, #LOAD framing and the number of ticks per byte.
+//
+// Example (from the repository root):
+//   g++ -std=c++17 -Wall -I components/sda5708 -o /tmp/sda5708_shift_sim tools/sda5708_shift_sim.cpp && /tmp/sda5708_shift_sim
+#include <cstdio>
+#include <vector>
+
+#include "sda5708_shift.h"
+
+using esphome::sda5708::SDABusLevels;
+using esphome::sda5708::SDAShifter;
+using esphome::sda5708::SDAShiftQueue;
+
+static int failures = 0;
+
+static void check(const bool condition, const char *message, const unsigned long tick)
+{
+  if (condition)
+    return;
+
+  printf("FAIL at tick %lu: %s\n", tick, message);
+  failures++;
+}
+
+/// Decodes bytes from the bus levels after each tick, like the screen does.
+class BusDecoder
+{
+public:
+  void sample(const SDABusLevels &levels, const unsigned long tick)
+  {
+    if (!levels.load)
+    {
+      if (this->previous_.load)
+      {
+        // start of a transfer, the clock must be low so the first data bit is set up before the first edge
+        check(!levels.clock, "#LOAD falls while the clock is high", tick);
+        this->bits_ = 0;
+        this->byte_ = 0;
+        this->start_ = tick;
+      }
+      if (levels.clock && !this->previous_.clock)
+      {
+        check(this->bits_ < 8, "more than 8 clock pulses in a transfer", tick);
+        this->byte_ |= (levels.data ? 1 : 0) << this->bits_;
+        this->bits_++;
+      }
+      if (levels.clock && this->previous_.clock)
+        check(levels.data == this->previous_.data, "data changes while the clock is high", tick);
+    }
+    else if (!this->previous_.load)
+    {
+      // end of a transfer
+      check(!levels.clock, "#LOAD rises while the clock is high", tick);
+      check(this->bits_ == 8, "transfer without exactly 8 clock pulses", tick);
+      check(tick - this->start_ + 1 == SDAShifter::TICKS_PER_BYTE, "byte does not take TICKS_PER_BYTE ticks", tick);
+      this->bytes_.push_back(this->byte_);
+    }
+    else
+    {
+      check(!levels.clock, "clock pulse outside of a transfer", tick);
+    }
+
+    this->previous_ = levels;
+  }
+
+  const std::vector<uint8_t> &get_bytes() const
+  {
+    return this->bytes_;
+  }
+
+private:
+  SDABusLevels previous_{};
+  std::vector<uint8_t> bytes_;
+  uint8_t byte_ = 0;
+  uint8_t bits_ = 0;
+  unsigned long start_ = 0;
+};
+
+int main()
+{
+  SDAShiftQueue queue;
+  SDAShifter shifter;
+  BusDecoder decoder;
+
+  // all byte values, in chunks of varying size so the queue wraps and the timer is stopped and started in between
+  std::vector<uint8_t> sent;
+  for (unsigned value = 0; value < 768; value++)
+    sent.push_back(static_cast<uint8_t>(value * 37 + 11));
+
+  unsigned long tick = 0;
+  unsigned long active_ticks = 0;
+  size_t next = 0;
+  size_t chunk = 1;
+  while (next < sent.size())
+  {
+    for (size_t i = 0; i < chunk && next < sent.size(); i++)
+    {
+      if (!queue.push(sent[next]))
+        break;
+      next++;
+    }
+    chunk = chunk % (SDAShiftQueue::SIZE + 7) + 13;
+
+    // run the timer until the state machine reports it can be stopped
+    while (shifter.tick(queue))
+    {
+      tick++;
+      active_ticks++;
+      decoder.sample(shifter.get_levels(), tick);
+    }
+
+    check(!shifter.is_busy() && queue.empty(), "timer stopped with bytes left", tick);
+    check(shifter.get_levels().load && !shifter.get_levels().clock, "bus not idle after the timer stopped", tick);
+
+    // the timer is stopped, time passes without ticks
+    tick += 100;
+  }
+
+  const std::vector<uint8_t> &received = decoder.get_bytes();
+  check(received == sent, "received bytes differ from the sent bytes", tick);
+  check(active_ticks == sent.size() * SDAShifter::TICKS_PER_BYTE, "ticks per byte do not add up", tick);
+
+  printf("%zu bytes, %lu ticks: %s\n", received.size(), active_ticks, failures == 0 ? "OK" : "FAILED");
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,102 @@
+"""Send frames to a SDA5708 display using the sda5708 stream protocol.
+
+Frames are read from a text file (7 lines of up to 40 characters per frame, '#' for lit pixels,
+frames separated by an empty line) or generated as a scrolling test pattern.
+
+Examples:
+  python3 sda5708_stream.py --host 192.168.1.50 --port 5708 --fps 30
+  python3 sda5708_stream.py --host 127.0.0.1 --port 5708 (host platform stand-in, see README)
+  python3 sda5708_stream.py --serial /dev/ttyUSB0 --baud 115200 frames.txt
+"""
+import argparse
+import socket
+import time
+
+SYNC = 0xA5
+TYPE_FRAME = 0x01
+TYPE_DELTA = 0x02
+TYPE_CONTROL = 0x03
+
+ROWS = 7
+COLUMNS = 40
+
+
+def packet(packet_type, seq, payload):
+    checksum = (packet_type + seq + sum(payload)) & 0xFF
+    return bytes([SYNC, packet_type, seq]) + bytes(payload) + bytes([checksum])
+
+
+def frame_payload(frame):
+    # 7 rows of 40 columns, 5 bytes per row, leftmost column is the MSB
+    payload = []
+    for row in frame:
+        bits = 0
+        for x in range(COLUMNS):
+            bits = (bits << 1) | (1 if x < len(row) and row[x] == '#' else 0)
+        payload.extend(bits.to_bytes(COLUMNS // 8, "big"))
+    return payload
+
+
+def load_frames(path):
+    frames = []
+    current = []
+    with open(path, encoding="utf-8") as f:
+        for line in f.read().splitlines():
+            if not line.strip() and len(current) == ROWS:
+                frames.append(current)
+                current = []
+            elif len(current) < ROWS:
+                current.append(line[:COLUMNS])
+    if len(current) == ROWS:
+        frames.append(current)
+    return frames
+
+
+def test_pattern():
+    # a vertical bar moving across the screen
+    for x in range(COLUMNS):
+        yield [" " * x + "#" for _ in range(ROWS)]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("frames", nargs="?", help="frame file, defaults to a test pattern")
+    parser.add_argument("--host", help="host to connect to (TCP)")
+    parser.add_argument("--port", type=int, default=5708, help="TCP port")
+    parser.add_argument("--serial", help="serial port to use instead of TCP (requires pyserial)")
+    parser.add_argument("--baud", type=int, default=115200, help="serial baud rate")
+    parser.add_argument("--fps", type=float, default=20.0, help="frames per second")
+    parser.add_argument("--brightness", type=int, choices=range(8), help="send a brightness control packet first")
+    parser.add_argument("--loop", action="store_true", help="repeat the frames until interrupted")
+    args = parser.parse_args()
+
+    if args.serial:
+        import serial  # pylint: disable=import-outside-toplevel
+
+        port = serial.Serial(args.serial, args.baud)
+        send = port.write
+    elif args.host:
+        sock = socket.create_connection((args.host, args.port))
+        send = sock.sendall
+    else:
+        parser.error("either --host or --serial is required")
+
+    frames = load_frames(args.frames) if args.frames else list(test_pattern())
+    seq = 0
+
+    if args.brightness is not None:
+        send(packet(TYPE_CONTROL, seq, [args.brightness]))
+        seq = (seq + 1) & 0xFF
+
+    while True:
+        for frame in frames:
+            start = time.monotonic()
+            send(packet(TYPE_FRAME, seq, frame_payload(frame)))
+            seq = (seq + 1) & 0xFF
+            time.sleep(max(0.0, 1.0 / args.fps - (time.monotonic() - start)))
+        if not args.loop:
+            break
+
+
+if __name__ == "__main__":
+    main()
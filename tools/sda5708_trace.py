@@ -0,0 +1,165 @@
+"""Decode a SDA5708 bus trace and replay it into frames.
+
+The trace is read from a device log containing the output of the `sda5708.dump_bus_trace` action
+(lines with "TRACE <index> <hex records>"), or from a binary file of raw 6 byte records with --binary.
+Each record holds the time in micros() (4 bytes, big endian), flags and the byte sent to the screen.
+
+Frames are written in the format read by sda5708_stream.py, so a trace can be replayed on another display.
+
+Examples:
+  python3 sda5708_trace.py device.log
+  python3 sda5708_trace.py --ops device.log
+  python3 sda5708_trace.py --output frames.txt device.log
+"""
+import argparse
+import re
+import sys
+
+RECORD_SIZE = 6
+FLAG_RESET = 0x01
+
+DIGITS = 8
+ROWS = 7
+DIGIT_COLUMNS = 5
+
+TRACE_LINE = re.compile(r"TRACE ([0-9A-Fa-f]{4}) ([0-9a-f]+)")
+
+
+def parse_log(text):
+    # collect the hex records of the last complete dump in the log
+    records = b""
+    current = None
+    for line in text.splitlines():
+        if "TRACE BEGIN" in line:
+            current = b""
+        elif "TRACE END" in line and current is not None:
+            records = current
+            current = None
+        elif current is not None:
+            match = TRACE_LINE.search(line)
+            if match:
+                current += bytes.fromhex(match.group(2))
+    if current:
+        # dump without end marker, e.g. a truncated log
+        records = current
+    return records
+
+
+def decode_records(data):
+    for offset in range(0, len(data) - RECORD_SIZE + 1, RECORD_SIZE):
+        time = int.from_bytes(data[offset:offset + 4], "big")
+        yield time, data[offset + 4], data[offset + 5]
+
+
+def describe(flags, byte):
+    if flags & FLAG_RESET:
+        return "RESET"
+    if byte & 0b11000000 == 0b11000000:
+        clear = "" if byte & (1 << 5) else " CLEAR"
+        peak = "12.5%" if byte & (1 << 4) else "max"
+        return f"CONTROL brightness={byte & 0b111} peak={peak}{clear}"
+    if byte & 0b11100000 == 0b10100000:
+        return f"ADDRESS digit={byte & 0b111}"
+    if byte & 0b11100000 == 0:
+        return f"DATA {byte & 0b11111:05b}"
+    return f"UNKNOWN 0x{byte:02x}"
+
+
+class Screen:
+    """Replays bus operations like the screen controller does."""
+
+    def __init__(self):
+        self.reset()
+
+    def reset(self):
+        self.glyphs = [[0] * ROWS for _ in range(DIGITS)]
+        self.digit = 0
+        self.row = 0
+        self.brightness = 0
+
+    def apply(self, flags, byte):
+        if flags & FLAG_RESET:
+            self.reset()
+        elif byte & 0b11000000 == 0b11000000:
+            self.brightness = byte & 0b111
+            if not byte & (1 << 5):
+                self.glyphs = [[0] * ROWS for _ in range(DIGITS)]
+        elif byte & 0b11100000 == 0b10100000:
+            self.digit = byte & 0b111
+            self.row = 0
+        elif byte & 0b11100000 == 0 and self.row < ROWS:
+            self.glyphs[self.digit][self.row] = byte & 0b11111
+            self.row += 1
+
+    def frame(self, rotated):
+        rows = []
+        for row in range(ROWS):
+            line = ""
+            for digit in range(DIGITS):
+                bits = self.glyphs[digit][row]
+                line += "".join("#" if bits & (1 << (DIGIT_COLUMNS - 1 - col)) else " " for col in range(DIGIT_COLUMNS))
+            rows.append(line)
+        if rotated:
+            rows = [line[::-1] for line in reversed(rows)]
+        return rows
+
+
+def replay(records, gap, rotated):
+    # a frame is complete once the bus is idle for longer than `gap` microseconds
+    screen = Screen()
+    frames = []
+    last_time = None
+    for time, flags, byte in records:
+        if last_time is not None and (time - last_time) & 0xFFFFFFFF > gap:
+            frames.append((last_time, screen.frame(rotated)))
+        screen.apply(flags, byte)
+        last_time = time
+    if last_time is not None:
+        frames.append((last_time, screen.frame(rotated)))
+    return frames
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("trace", nargs="?", help="log or binary trace file, defaults to stdin")
+    parser.add_argument("--binary", action="store_true", help="the trace file contains raw records")
+    parser.add_argument("--ops", action="store_true", help="list the decoded bus operations")
+    parser.add_argument("--gap", type=int, default=1000, help="bus idle time ending a frame, in microseconds")
+    parser.add_argument("--rotated", action="store_true", help="the screen is mounted upside down (rotate_screen)")
+    parser.add_argument("--output", help="write the frames to this file instead of printing them")
+    args = parser.parse_args()
+
+    if args.binary:
+        with open(args.trace, "rb") if args.trace else sys.stdin.buffer as f:
+            data = f.read()
+    else:
+        with open(args.trace, encoding="utf-8", errors="replace") if args.trace else sys.stdin as f:
+            data = parse_log(f.read())
+
+    records = list(decode_records(data))
+    if not records:
+        sys.exit("no trace records found")
+
+    if args.ops:
+        start = records[0][0]
+        for time, flags, byte in records:
+            print(f"{(time - start) & 0xFFFFFFFF:>10} us  {describe(flags, byte)}")
+        return
+
+    frames = replay(records, args.gap, args.rotated)
+    if args.output:
+        with open(args.output, "w", encoding="utf-8") as f:
+            f.write("\n".join("\n".join(frame) + "\n" for _, frame in frames))
+        print(f"wrote {len(frames)} frames to {args.output}")
+        return
+
+    start = records[0][0]
+    for time, frame in frames:
+        print(f"@ {(time - start) & 0xFFFFFFFF} us")
+        for line in frame:
+            print(f"|{line}|")
+        print()
+
+
+if __name__ == "__main__":
+    main()